@@ -26,6 +26,7 @@
 #define BTN_LEFT      33  // Navigate to previous UI button (GPIO14)
 #define BTN_RIGHT     14  // Navigate to next UI button (GPIO33)
 #define BTN_SELECT    26  // Activate highlighted UI button (GPIO26)
+#define BTN_IDLE_WAKE_MS  100  // Input loop wake-up without button interrupts (DTC count, serial keys)
 
 // ============================================================================
 // BLUETOOTH CONFIGURATION
@@ -38,9 +39,13 @@
 #define BT_PIN              "1234"                     // PIN (often not needed)
 
 // Connection Settings
-#define BT_RECONNECT_DELAY_MS   5000   // Wait 5s before reconnect attempt
 #define BT_CONNECT_TIMEOUT_MS   10000  // 10s timeout for connection
 
+// Link Recovery (prompt resync -> SPP reconnect -> full Bluetooth restart)
+#define BT_FAST_RECONNECT_TIMEOUT_MS  1500   // SPP reconnect with the stack kept up
+#define BT_RECONNECT_BACKOFF_MIN_MS   1000   // First wait after a failed full restart
+#define BT_RECONNECT_BACKOFF_MAX_MS   30000  // Backoff cap (doubles per failed restart)
+
 // ============================================================================
 // DISPLAY CONFIGURATION
 // ============================================================================
@@ -54,8 +59,43 @@
 // Use 1 for normal landscape, use 3 for landscape flipped 180°
 #define SCREEN_ROTATION 3  // Landscape flipped 180° (480x320)
 
-// Display Refresh Rate
-#define DISPLAY_REFRESH_MS  500    // 500ms = 2 Hz (2 updates per second)
+// Display Refresh (event-driven: frames are drawn when a shown value changes)
+#define DISPLAY_REFRESH_MS  500    // Animation tick for the connecting screen and stats page (2 Hz)
+
+// Startup Screen (stepped by the display task while the OBD2 task connects, see startup_screen.h)
+#define STARTUP_FRAME_MS        10     // One scan line step per frame
+#define STARTUP_BRANDING_MS     200    // Logo alone before the scan starts
+#define STARTUP_MAX_MS          20000  // Give up waiting for the first values, show the pages
+
+// Dashboard Layouts (see dashboard_layout.h)
+#define DASHBOARD_LAYOUT_FILE       "/layouts.json"  // Optional LittleFS override of the built-in layouts
+#define DASHBOARD_MAX_LAYOUTS       4      // Dashboard pages (SELECT on Dashboard tab cycles)
+#define DASHBOARD_MAX_CELLS         8      // Gauges per layout
+#define DASHBOARD_MAX_GRID          4      // Max columns/rows per layout
+#define DASHBOARD_MAX_VALUE_SIZE    8      // Largest value font (sprite RAM grows with it)
+#define DASHBOARD_CELL_MARGIN       5      // Gap between gauge boxes (px)
+
+// Graph Page (trend of one PID, one column per sample, see graph_page.h)
+#define GRAPH_GAP_MS            2000   // Samples further apart are not joined by a line
+
+// Panel Write Budget (ILI9488 power stability, see display_writer.h)
+// Calibrated from the stable strip clear: 10px full-width strip (4800 px) per 5 ms
+#define DISPLAY_PIXEL_BUDGET        9600   // Max pixels written per budget window
+#define DISPLAY_BUDGET_WINDOW_MS    10     // Budget window (ms)
+#define DISPLAY_FILL_STRIP_PIXELS   4800   // Large fills are split into strips of this size
+
+// DMA Pixel Pushes (sprite tiles sent in the background, see display_writer.h)
+// TFT_eSPI has no DMA path for the ILI9488 over SPI (18-bit colour) - keep disabled for this panel
+#define DISPLAY_USE_DMA             false
+#define DISPLAY_DMA_BUFFER_PIXELS   6400   // Per ping-pong buffer (2 buffers, DMA-capable RAM)
+
+// Chrome Cache (static page background blitted from PSRAM, see chrome_cache.h)
+// One 480x320 RGB565 frame per page (300 KB each) - falls back to direct drawing without PSRAM
+#define DISPLAY_CHROME_CACHE        true
+
+// Digit Atlas (anti-aliased value numerals rendered once per text size, see digit_atlas.h)
+// Coverage maps of 0-9 . - % V - about 34 KB at size 8, in PSRAM if available
+#define DISPLAY_DIGIT_ATLAS         true
 
 // Color Definitions (RGB565)
 #define COLOR_BLACK     0x0000
@@ -77,12 +117,90 @@
 // ELM327 Settings
 #define ELM327_BAUD_RATE        38400  // ELM327 standard baud rate
 #define ELM327_TIMEOUT_MS       2000   // 2s timeout for commands
-#define ELM327_INIT_DELAY_MS    2000   // Wait 2s after connection
+#define ELM327_READY_TIMEOUT_MS 2000   // Max wait for the first prompt after the SPP link is up
+#define ELM327_RX_BUFFER_SIZE   512    // Max reply text per command (up to '>' prompt)
+#define ELM327_MAX_DATA_BYTES   160    // Max decoded data bytes per reply (all frames)
+#define ELM_ENGINE_SLOTS        3      // Request slots (poll on the wire + poll decoding + sync command)
+#define ELM_ENGINE_CMD_LEN      24     // Max command length incl. terminator
+
+// ELM327 Link Tuning (applied after connect)
+// Echo, linefeeds, spaces and headers off shrink every reply; adaptive timing
+// and a shorter ATST stop the adapter from idling after the last ECU frame.
+#define ELM327_AT_TIMEOUT_MS        1000   // Timeout for AT setup commands
+#define ELM327_ADAPTIVE_TIMING      2      // ATAT2 (aggressive), clones fall back to ATAT1
+#define ELM327_ST_TIMEOUT           0x19   // ATST in 4 ms units (0x19 = 100 ms, default 0x32 = 200 ms)
+#define ELM327_ST_TIMEOUT_CLONE     0x32   // Clones lose frames with short timeouts - keep default
+#define ELM327_RESYNC_TIMEOUT_MS    300    // Wait for '>' after a bare CR (recovery tier 1)
+#define ELM327_PROBE_TIMEOUT_MS     1000   // ECU probe (0100) after resync/reconnect
+#define ELM327_SEARCH_TIMEOUT_MS    5000   // First ECU probe after connect (adapter searches the protocol)
+#define ELM327_ECU_READY_ATTEMPTS   3      // ECU probes after connect before polling starts anyway
 
 // OBD2 Query Settings
-#define OBD2_QUERY_INTERVAL_MS  200    // 5 Hz = query every 200ms (faster updates!)
+#define OBD2_QUERY_INTERVAL_MS  200    // Max idle time between scheduler passes
 #define OBD2_MAX_RETRIES        3      // Retry failed queries 3 times
 
+// Batched Mode 01 Queries
+// ISO 15765-4 CAN ECUs accept up to 6 PIDs in one request ("010C0D05110F42").
+// Falls back to single-PID queries automatically if the ECU rejects it.
+#define OBD2_BATCH_QUERIES          true   // Request all live PIDs in one message
+#define OBD2_MAX_PIDS_PER_REQUEST   6      // ISO 15765-4 limit per Mode 01 request
+
+// Diagnostic Trouble Codes
+// Stored (03), pending (07) and permanent (0A) codes are merged into one list.
+// Multi-frame (ISO-TP) replies are reassembled, so one ECU can report more
+// than the 3 codes of a single frame.
+#define MAX_DTC_CODES               32     // Max codes kept after merging all modes
+
+// Freeze Frames (Mode 02)
+// Read once per change of the DTC set (codes or their status), not on every
+// refresh. PID 02 of a frame names the code that stored it; the signals below
+// come with it, FREEZE_FRAME_PAIRS_PER_REQUEST PID/frame pairs per request.
+#define FREEZE_FRAME_PIDS           {PID_RPM, PID_SPEED, PID_COOLANT_TEMP, \
+                                     PID_ENGINE_LOAD, PID_THROTTLE}  // Signals per frame (max 8)
+#define FREEZE_FRAME_MAX_FRAMES     1      // Frames read (ISO 15765-4 ECUs keep frame 0 only)
+#define FREEZE_FRAME_PAIRS_PER_REQUEST 3   // ISO 15765-4 limit per Mode 02 request
+
+// PID Polling Schedule
+// Each PID is polled at its target interval; the scheduler always picks the
+// most overdue PID(s). Priority (1=low, 3=high) breaks ties between PIDs
+// that are equally overdue.
+#define PID_INTERVAL_RPM_MS         100    // 10 Hz
+#define PID_INTERVAL_SPEED_MS       100    // 10 Hz
+#define PID_INTERVAL_THROTTLE_MS    100    // 10 Hz
+#define PID_INTERVAL_COOLANT_MS     2000   // 0.5 Hz
+#define PID_INTERVAL_INTAKE_MS      2000   // 0.5 Hz
+#define PID_INTERVAL_BATTERY_MS     1000   // 1 Hz
+#define PID_INTERVAL_MAF_MS         200    // 5 Hz (fuel rate)
+#define PID_INTERVAL_MAP_MS         200    // 5 Hz (boost, speed-density airflow)
+#define PID_INTERVAL_LOAD_MS        500    // 2 Hz
+#define PID_INTERVAL_BARO_MS        10000  // 0.1 Hz (boost reference)
+
+#define PID_PRIORITY_RPM            3
+#define PID_PRIORITY_SPEED          3
+#define PID_PRIORITY_THROTTLE       3
+#define PID_PRIORITY_COOLANT        1
+#define PID_PRIORITY_INTAKE         1
+#define PID_PRIORITY_BATTERY        2
+#define PID_PRIORITY_MAF            2
+#define PID_PRIORITY_MAP            2
+#define PID_PRIORITY_LOAD           1
+#define PID_PRIORITY_BARO           1
+
+// Sport Mode (Config page toggle)
+// Polls only these PIDs back to back, ignoring the intervals above. The batch
+// is the same request every time, so it is sent as a bare CR (ELM327 repeat).
+#define SPORT_MODE_PIDS             {PID_RPM, PID_SPEED, PID_THROTTLE}
+#define SPORT_MODE_REPEAT           true   // Repeat identical requests with a bare CR
+
+// Supported-PID discovery (0100/0120/0140), cached per VIN in NVS
+#define PID_SUPPORT_NVS_NAMESPACE   "obdeck_pids"
+
+// Warm-Start Cache (last VIN, adapter, DTCs and page in NVS, see warm_start.h)
+// Written by the input loop only after the state settled, at most once per interval
+#define WARM_START_NVS_NAMESPACE    "obdeck_state"
+#define WARM_START_SETTLE_MS        5000   // Quiet time before a change is written (coalesces bursts)
+#define WARM_START_MIN_INTERVAL_MS  30000  // Min time between two NVS writes (flash wear)
+
 // Supported PIDs (Mode 01)
 #define PID_COOLANT_TEMP        0x05   // Engine coolant temperature
 #define PID_RPM                 0x0C   // Engine RPM
@@ -90,16 +208,109 @@
 #define PID_INTAKE_TEMP         0x0F   // Intake air temperature
 #define PID_THROTTLE            0x11   // Throttle position
 #define PID_BATTERY_VOLTAGE     0x42   // Control module voltage
+#define PID_ENGINE_LOAD         0x04   // Calculated engine load
+#define PID_MAP                 0x0B   // Intake manifold absolute pressure
+#define PID_MAF                 0x10   // Mass air flow rate
+#define PID_BARO                0x33   // Barometric pressure
+#define PID_FREEZE_DTC          0x02   // Mode 02 only: code that stored the freeze frame
+
+// Derived Metrics (see obd2/derived_metrics.h)
+// Computed on Core 0 from the polled PIDs, no extra queries. Airflow comes
+// from MAF if the ECU reports it, else speed-density (MAP, IAT, RPM).
+#define DERIVED_DISPLACEMENT_CC     1229   // Z12XEP 1.2 (speed-density airflow)
+#define DERIVED_VE_PERCENT          85     // Volumetric efficiency estimate (speed-density)
+#define DERIVED_AFR_X10             147    // Stoichiometric air/fuel ratio (petrol)
+#define DERIVED_FUEL_DENSITY_G_L    745    // Petrol density
+#define DERIVED_EMA_SHIFT_FUEL      3      // Fuel rate filter weight 1/8 per sample
+#define DERIVED_EMA_SHIFT_SPEED     2      // Speed filter weight 1/4 per sample (consumption)
+#define DERIVED_EMA_SHIFT_LOAD      1      // Load filter weight 1/2 per sample
+#define DERIVED_EMA_SHIFT_MAP       1      // Boost filter weight 1/2 per sample
+#define DERIVED_MIN_SPEED_KMH       5      // Below: no instant L/100km (shows "--")
+#define DERIVED_TRIP_MIN_M          500    // Trip average shown after this distance
+#define DERIVED_MAX_GAP_MS          2000   // Longer gaps between polls are not integrated
+
+// Trend History (recent samples per live PID, see pid_history.h)
+#define PID_HISTORY_CAPACITY    512    // Samples per PID (power of two, 4 KB per PID, PSRAM if available)
+
+// ============================================================================
+// TRIP LOGGER CONFIGURATION
+// ============================================================================
+
+// Binary trip log on the LittleFS ("spiffs") partition of huge_app.csv (~896 KB)
+// 3-4 byte records: RPM/speed/throttle at 10 Hz (100 B/s), MAP/MAF at 5 Hz (35 B/s),
+// slow PIDs only on change (~10 B/s) = ~145 B/s = ~520 KB/hour, ~1.7 hours per partition
+#define TRIP_LOG_ENABLED            true
+#define TRIP_LOG_DIR                "/trips"
+#define TRIP_LOG_RING_BYTES         8192   // Ring buffer (power of two, ~55 s of records, PSRAM if available)
+#define TRIP_LOG_BLOCK_BYTES        4096   // Sequential write size (one flash sector)
+#define TRIP_LOG_FLUSH_MS           10000  // Write partial block after this long (limits loss on power cut)
+#define TRIP_LOG_POLL_MS            250    // Writer task idle sleep
+#define TRIP_LOG_MIN_FREE_BYTES     16384  // Delete oldest trips below this much free space
+#define TRIP_LOG_CHANGE_ONLY_PIDS   {PID_COOLANT_TEMP, PID_INTAKE_TEMP, PID_BATTERY_VOLTAGE, \
+                                     PID_ENGINE_LOAD, PID_BARO}  // Written only when the value changed
+
+// ============================================================================
+// TELEMETRY CONFIGURATION
+// ============================================================================
+
+// Wi-Fi live stream: one MessagePack frame per batch interval over UDP broadcast
+// (src/telemetry/). Wi-Fi shares the 2.4 GHz radio with the ELM327's Classic BT -
+// coexistence prefers BT and the stream stays at a few small frames per second.
+#define TELEMETRY_ENABLED           false  // Off by default (costs ~40 KB RAM for the Wi-Fi stack)
+#define TELEMETRY_WIFI_AP           true   // true = own access point, false = join an existing network
+#define TELEMETRY_WIFI_SSID         "OBDeck"
+#define TELEMETRY_WIFI_PASSWORD     "obdeck-pit"  // AP mode needs at least 8 characters
+#define TELEMETRY_WIFI_CHANNEL      6      // AP channel
+#define TELEMETRY_UDP_PORT          5005   // Frames go to the subnet broadcast address
+#define TELEMETRY_BATCH_MS          200    // One frame per interval with all new samples (5 Hz)
+#define TELEMETRY_MAX_SAMPLES       48     // Samples per frame (the rest follow in the next frame)
+#define TELEMETRY_FRAME_BYTES       1024   // Encoded frame limit (below one UDP/Wi-Fi MTU)
+#define TELEMETRY_PIDS              {PID_RPM, PID_SPEED, PID_THROTTLE, PID_COOLANT_TEMP, \
+                                     PID_INTAKE_TEMP, PID_BATTERY_VOLTAGE}  // PIDs with a history ring
+
+// ============================================================================
+// METRICS CONFIGURATION
+// ============================================================================
+
+// Runtime instrumentation (src/metrics/) - stats page and serial dump
+#define METRICS_HISTOGRAM_BUCKETS   20     // Log2 buckets: 0, 1, 2-3, ... >= 2^18
+#define METRICS_RATE_WINDOW_MS      1000   // Window for achieved Hz / frame averages
+#define METRICS_DUMP_KEY            'm'    // Send over serial to print all metrics
+#define STATS_PAGE_REFRESH_MS       1000   // Stats page update interval
+#define METRICS_LOG_POLLS           false  // Print every decoded poll (debug only - floods serial at the poll rate)
+
+// Task/heap profiler (src/metrics/profiler.h) - sampled by the input loop
+#define PROFILER_SAMPLE_MS          1000   // Task CPU, stack and heap sample interval
+#define PROFILER_LOG_MS             30000  // Serial summary line interval (0 = dump only)
+#define PROFILER_MAX_TASKS          32     // Tasks per sample (~20 with the BT stack running)
+#define PROFILER_STACK_WARN_BYTES   512    // Stack headroom flagged below this
 
 // ============================================================================
 // THREADING CONFIGURATION
 // ============================================================================
 
-// FreeRTOS Task Configuration (OBD2 runs on Core 0, Display runs in main loop on Core 1)
+// FreeRTOS Task Configuration (OBD2 runs on Core 0, Display task and input loop on Core 1)
 #define OBD2_TASK_STACK_SIZE    8192   // 8KB stack for OBD2 task
 #define OBD2_TASK_PRIORITY      1      // Priority 1 (lower)
 #define OBD2_TASK_CORE          0      // Run on Core 0
 
+#define DISPLAY_TASK_STACK_SIZE 6144   // 6KB stack for display task
+#define DISPLAY_TASK_PRIORITY   1      // Same as Arduino loop (time-sliced with input handling)
+#define DISPLAY_TASK_CORE       1      // Run on Core 1
+#define DISPLAY_QUEUE_LENGTH    8      // Pending render commands (page redraws, highlight moves)
+
+#define ELM_ENGINE_TASK_STACK_SIZE 4096  // 4KB stack for the ELM command engine
+#define ELM_ENGINE_TASK_PRIORITY 2     // Above OBD2 task - next request goes out right at the prompt
+#define ELM_ENGINE_TASK_CORE    0      // Run on Core 0 (next to the OBD2 task)
+
+#define TRIP_LOG_TASK_STACK_SIZE 4096  // 4KB stack for trip log writer
+#define TRIP_LOG_TASK_PRIORITY  0      // Lowest - only runs while the OBD2 task waits
+#define TRIP_LOG_TASK_CORE      0      // Run on Core 0 (next to its producer)
+
+#define TELEMETRY_TASK_STACK_SIZE 4096 // 4KB stack for the telemetry sender
+#define TELEMETRY_TASK_PRIORITY 0      // Lowest - never competes with the OBD2 task or the display
+#define TELEMETRY_TASK_CORE     1      // Run on Core 1 (Wi-Fi and BT stacks run on Core 0)
+
 // ============================================================================
 // VEHICLE INFORMATION
 // ============================================================================
@@ -5,14 +5,25 @@
  * - LEFT: Move highlight to previous UI button
  * - RIGHT: Move highlight to next UI button
  * - SELECT: Activate currently highlighted button
+ *
+ * Presses are latched by GPIO interrupts, which wake the sleeping input loop.
+ *
+ * Runs in the input loop: updates UI state and queues drawing for the
+ * display task (requestHighlightMove / requestDTCScroll / page_needs_redraw), never touches the TFT
+ * except for drawButtonHighlight(), which only the display task calls
  */
 
 #ifndef BUTTON_NAV_H
 #define BUTTON_NAV_H
 
+#include <atomic>
 #include "ui_common.h"
 #include "../obd2/obd_data.h"
 #include "dtc_page.h"  // For scrollDTCUp/Down functions
+#include "dashboard_layout.h"  // For dashboard layout cycling
+#include "graph_page.h"  // For graph signal cycling
+#include "stats_page.h"  // For stats view cycling
+#include "display_manager.h"  // For render queue requests
 
 // ============================================================================
 // BUTTON CONFIGURATION
@@ -32,13 +43,17 @@ enum ButtonID {
     BTN_NAV_CONFIG = 2,
 
     // DTC Page Buttons
-    BTN_DTC_REFRESH = 3,
-    BTN_DTC_CLEAR = 4,
-    BTN_DTC_UP = 5,
-    BTN_DTC_DOWN = 6,
+    BTN_DTC_DETAIL = 3,
+    BTN_DTC_REFRESH = 4,
+    BTN_DTC_CLEAR = 5,
+    BTN_DTC_UP = 6,
+    BTN_DTC_DOWN = 7,
+
+    // Config Page Buttons
+    BTN_CONFIG_SPORT = 8,
 
     // Placeholder for future buttons
-    BTN_MAX = 7
+    BTN_MAX = 9
 };
 
 struct UIButton {
@@ -48,35 +63,84 @@ struct UIButton {
     Page page;            // Which page this button belongs to (PAGE_MAX = all pages)
 };
 
-// Global button array
-static UIButton ui_buttons[] = {
-    // Bottom Navigation (always visible on all pages)
-    {BTN_NAV_DASHBOARD, 0,   BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},  // Page 99 = always visible
-    {BTN_NAV_DTC,       160, BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},
-    {BTN_NAV_CONFIG,    320, BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},
-
-    // DTC Page Buttons (only visible on DTC page)
-    {BTN_DTC_REFRESH, 290, CONTENT_Y_START + 3, 90, 26, true, PAGE_DTC},
-    {BTN_DTC_CLEAR,   390, CONTENT_Y_START + 3, 85, 26, true, PAGE_DTC},
-    {BTN_DTC_UP,      80,  BOTTOM_NAV_Y - 48, 140, 38, false, PAGE_DTC},  // Enabled dynamically
-    {BTN_DTC_DOWN,    260, BOTTOM_NAV_Y - 48, 140, 38, false, PAGE_DTC},  // Enabled dynamically
-};
+// Global button array (declared here, defined in obdeck.ino)
+// Written by the input loop only, read by the display task
+extern UIButton ui_buttons[BTN_MAX];
+
 
 // Current highlighted button index (declared here, defined in obdeck.ino)
 extern int current_button_index;
 
+// ============================================================================
+// BUTTON INTERRUPTS
+// ============================================================================
+
+// Pending press bits (set by the GPIO interrupt, taken by handleButtonInput)
+#define BTN_PRESS_LEFT      (1 << 0)
+#define BTN_PRESS_RIGHT     (1 << 1)
+#define BTN_PRESS_SELECT    (1 << 2)
+
+/**
+ * Presses latched since the last handleButtonInput() (shared by all includers)
+ */
+inline std::atomic<uint32_t>& buttonPressBits() {
+    static std::atomic<uint32_t> bits(0);
+    return bits;
+}
+
+/**
+ * Task woken by button interrupts (the input loop, set in initButtonNav)
+ */
+inline TaskHandle_t& buttonWakeTask() {
+    static TaskHandle_t task = NULL;
+    return task;
+}
+
+/**
+ * GPIO interrupt (falling edge): latch the press and wake the input loop
+ * @param arg BTN_PRESS_* bit of the button
+ */
+inline void ARDUINO_ISR_ATTR onButtonInterrupt(void* arg) {
+    buttonPressBits().fetch_or((uint32_t)(uintptr_t)arg);
+
+    TaskHandle_t task = buttonWakeTask();
+    if (task != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * Sleep the input loop until a button interrupt fires
+ * @param timeout_ms Maximum sleep (periodic input work: DTC count, serial keys)
+ * @return false if the sleep timed out (idle wake-up)
+ */
+inline bool waitForButtonInput(uint32_t timeout_ms) {
+    return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms)) != 0;
+}
+
 // ============================================================================
 // BUTTON INITIALIZATION
 // ============================================================================
 
 /**
- * Initialize physical button GPIO pins
+ * Initialize physical button GPIO pins and their interrupts
+ * Must be called from the input loop's task (setup() runs in the loop task)
  */
 inline void initButtonNav() {
     pinMode(BTN_LEFT, INPUT_PULLUP);
     pinMode(BTN_RIGHT, INPUT_PULLUP);
     pinMode(BTN_SELECT, INPUT_PULLUP);
 
+    buttonWakeTask() = xTaskGetCurrentTaskHandle();
+    attachInterruptArg(digitalPinToInterrupt(BTN_LEFT), onButtonInterrupt,
+                       (void*)(uintptr_t)BTN_PRESS_LEFT, FALLING);
+    attachInterruptArg(digitalPinToInterrupt(BTN_RIGHT), onButtonInterrupt,
+                       (void*)(uintptr_t)BTN_PRESS_RIGHT, FALLING);
+    attachInterruptArg(digitalPinToInterrupt(BTN_SELECT), onButtonInterrupt,
+                       (void*)(uintptr_t)BTN_PRESS_SELECT, FALLING);
+
     Serial.println("✓ Button navigation initialized");
     Serial.printf("  LEFT=GPIO%d, RIGHT=GPIO%d, SELECT=GPIO%d\n",
                   BTN_LEFT, BTN_RIGHT, BTN_SELECT);
@@ -100,7 +164,17 @@ inline void updateButtonVisibility(Page current_page, int dtc_count, int dtc_scr
     ui_buttons[BTN_NAV_CONFIG].enabled = true;
 
     // DTC page buttons
-    if (current_page == PAGE_DTC) {
+    if (current_page == PAGE_DTC && getDTCDetailIndex(dtc_count) >= 0) {
+        // Detail view: only NEXT (and the nav tabs)
+        ui_buttons[BTN_DTC_DETAIL].enabled = true;
+        ui_buttons[BTN_DTC_REFRESH].enabled = false;
+        ui_buttons[BTN_DTC_CLEAR].enabled = false;
+        ui_buttons[BTN_DTC_UP].enabled = false;
+        ui_buttons[BTN_DTC_DOWN].enabled = false;
+    } else if (current_page == PAGE_DTC) {
+        // Detail and Clear buttons only enabled when there are DTCs
+        ui_buttons[BTN_DTC_DETAIL].enabled = (dtc_count > 0);
+
         // Refresh button always enabled on DTC page (even with 0 DTCs)
         ui_buttons[BTN_DTC_REFRESH].enabled = true;
 
@@ -108,21 +182,25 @@ inline void updateButtonVisibility(Page current_page, int dtc_count, int dtc_scr
         ui_buttons[BTN_DTC_CLEAR].enabled = (dtc_count > 0);
 
         // Scroll buttons only if DTCs need scrolling
-        if (dtc_count > 4) {  // DTC_ITEMS_PER_PAGE = 4
+        if (dtc_count > DTC_ITEMS_PER_PAGE) {
             ui_buttons[BTN_DTC_UP].enabled = (dtc_scroll_offset > 0);
-            ui_buttons[BTN_DTC_DOWN].enabled = (dtc_scroll_offset + 4 < dtc_count);
+            ui_buttons[BTN_DTC_DOWN].enabled = (dtc_scroll_offset + DTC_ITEMS_PER_PAGE < dtc_count);
         } else {
             ui_buttons[BTN_DTC_UP].enabled = false;
             ui_buttons[BTN_DTC_DOWN].enabled = false;
         }
     } else {
         // Not on DTC page - disable all DTC buttons
+        ui_buttons[BTN_DTC_DETAIL].enabled = false;
         ui_buttons[BTN_DTC_REFRESH].enabled = false;
         ui_buttons[BTN_DTC_CLEAR].enabled = false;
         ui_buttons[BTN_DTC_UP].enabled = false;
         ui_buttons[BTN_DTC_DOWN].enabled = false;
     }
 
+    // Config page buttons
+    ui_buttons[BTN_CONFIG_SPORT].enabled = (current_page == PAGE_CONFIG);
+
     // Safety check: if current button is not visible/enabled on current page,
     // reset to the appropriate nav button for this page
     if (current_button_index >= 0 && current_button_index < BTN_MAX) {
@@ -136,12 +214,14 @@ inline void updateButtonVisibility(Page current_page, int dtc_count, int dtc_scr
             // Current button not visible - reset to appropriate nav button
             switch (current_page) {
                 case PAGE_DASHBOARD:
+                case PAGE_GRAPH:
                     current_button_index = BTN_NAV_DASHBOARD;
                     break;
                 case PAGE_DTC:
                     current_button_index = BTN_NAV_DTC;
                     break;
                 case PAGE_CONFIG:
+                case PAGE_STATS:
                     current_button_index = BTN_NAV_CONFIG;
                     break;
                 default:
@@ -232,19 +312,24 @@ inline void drawButtonHighlight(int button_index, bool show, Page current_page)
                 if (btn.id >= BTN_NAV_DASHBOARD && btn.id <= BTN_NAV_CONFIG) {
                     // Nav buttons: check if this button is the active page
                     bool is_active_page = false;
-                    if (btn.id == BTN_NAV_DASHBOARD && current_page == PAGE_DASHBOARD) is_active_page = true;
+                    if (btn.id == BTN_NAV_DASHBOARD &&
+                        (current_page == PAGE_DASHBOARD || current_page == PAGE_GRAPH)) is_active_page = true;
                     if (btn.id == BTN_NAV_DTC && current_page == PAGE_DTC) is_active_page = true;
-                    if (btn.id == BTN_NAV_CONFIG && current_page == PAGE_CONFIG) is_active_page = true;
+                    if (btn.id == BTN_NAV_CONFIG &&
+                        (current_page == PAGE_CONFIG || current_page == PAGE_STATS)) is_active_page = true;
 
                     // Use GRAY for active page button, DARKGRAY for inactive
                     clear_color = is_active_page ? COLOR_GRAY : COLOR_DARKGRAY;
-                } else if (btn.id == BTN_DTC_REFRESH) {
-                    clear_color = COLOR_BLUE;  // Refresh button background
+                } else if (btn.id == BTN_DTC_REFRESH || btn.id == BTN_DTC_DETAIL) {
+                    clear_color = COLOR_BLUE;  // Refresh / detail button background
                 } else if (btn.id == BTN_DTC_CLEAR) {
                     clear_color = COLOR_RED;  // Clear All button background
                 } else if (btn.id == BTN_DTC_UP || btn.id == BTN_DTC_DOWN) {
                     // Scroll buttons: use BLUE if enabled, DARKGRAY if disabled
                     clear_color = btn.enabled ? COLOR_BLUE : COLOR_DARKGRAY;
+                } else if (btn.id == BTN_CONFIG_SPORT) {
+                    // Sport button: ORANGE while on, DARKGRAY while off (config_page.h)
+                    clear_color = obd_requests.sport_mode.load() ? COLOR_ORANGE : COLOR_DARKGRAY;
                 }
 
                 tft.drawRect(x, y, w, h, clear_color);
@@ -283,8 +368,7 @@ inline void navigateNextButton(Page current_page) {
         return;
     }
 
-    // Clear current highlight
-    drawButtonHighlight(current_button_index, false, current_page);
+    int previous_button = current_button_index;
 
     // Find current button in visible list
     int current_pos = -1;
@@ -304,8 +388,8 @@ inline void navigateNextButton(Page current_page) {
         current_button_index = visible_buttons[next_pos];
     }
 
-    // Draw new highlight
-    drawButtonHighlight(current_button_index, true, current_page);
+    // Redraw highlight on the display task
+    requestHighlightMove(previous_button, current_button_index, current_page);
 }
 
 /**
@@ -320,8 +404,7 @@ inline void navigatePreviousButton(Page current_page) {
         return;
     }
 
-    // Clear current highlight
-    drawButtonHighlight(current_button_index, false, current_page);
+    int previous_button = current_button_index;
 
     // Find current button in visible list
     int current_pos = -1;
@@ -341,8 +424,24 @@ inline void navigatePreviousButton(Page current_page) {
         current_button_index = visible_buttons[prev_pos];
     }
 
-    // Draw new highlight
-    drawButtonHighlight(current_button_index, true, current_page);
+    // Redraw highlight on the display task
+    requestHighlightMove(previous_button, current_button_index, current_page);
+}
+
+/**
+ * Queue the list scroll after a one-row step
+ * The scroll only repaints a scroll button that changed state - if the
+ * highlighted one just got disabled, the highlight moves to the DTC tab now
+ * (updateButtonVisibility alone would move it without drawing)
+ */
+inline void onDTCScrolled(Page current_page, int dtc_count) {
+    requestDTCScroll();
+
+    int previous_button = current_button_index;
+    updateButtonVisibility(current_page, dtc_count, dtc_scroll_offset);
+    if (current_button_index != previous_button) {
+        requestHighlightMove(previous_button, current_button_index, current_page);
+    }
 }
 
 /**
@@ -358,21 +457,54 @@ inline bool activateButton(Page& current_page, bool& page_needs_redraw, int dtc_
     switch (btn_id) {
         // Bottom Navigation
         case BTN_NAV_DASHBOARD:
-            if (current_page != PAGE_DASHBOARD) {
+            if (current_page == PAGE_GRAPH) {
+                // SELECT on Dashboard tab while on Graph: next signal, dashboard after the last
+                if (selectNextGraphSignal()) {
+                    Serial.printf("[Button] Graph signal: %s\n",
+                                  getGraphSignalInfo(getGraphSignal()).title);
+                } else {
+                    Serial.println("[Button] Switching to Dashboard page");
+                    if (getDashboardLayoutCount() > 1) {
+                        selectNextDashboardLayout();  // Wraps to the first layout
+                    }
+                    current_page = PAGE_DASHBOARD;
+                }
+                page_needs_redraw = true;
+            } else if (current_page != PAGE_DASHBOARD) {
                 Serial.println("[Button] Switching to Dashboard page");
                 current_page = PAGE_DASHBOARD;
                 page_needs_redraw = true;
                 // Keep Dashboard button highlighted after page change
                 current_button_index = BTN_NAV_DASHBOARD;
                 Serial.printf("[Button] Set current_button_index = %d (Dashboard)\n", current_button_index);
+            } else if (!obd_requests.sport_mode.load() &&
+                       getActiveDashboardLayout() + 1 < getDashboardLayoutCount()) {
+                // SELECT on Dashboard tab while on Dashboard: next layout
+                // (sport mode has a single fixed layout - straight to the graph page)
+                selectNextDashboardLayout();
+                Serial.printf("[Button] Dashboard layout: %s\n",
+                              getDashboardLayout(getActiveDashboardLayout()).name);
+                page_needs_redraw = true;
+            } else {
+                // Past the last layout: hidden graph page
+                Serial.println("[Button] Switching to Graph page");
+                resetGraphSignal();
+                current_page = PAGE_GRAPH;
+                page_needs_redraw = true;
             }
             return true;
 
         case BTN_NAV_DTC:
-            if (current_page != PAGE_DTC) {
+            if (current_page == PAGE_DTC && getDTCDetailIndex(dtc_count) >= 0) {
+                // SELECT on DTC tab while in the detail view: back to the list
+                Serial.println("[Button] DTC list");
+                closeDTCDetail();
+                page_needs_redraw = true;
+            } else if (current_page != PAGE_DTC) {
                 Serial.println("[Button] Switching to DTC page");
                 current_page = PAGE_DTC;
                 page_needs_redraw = true;
+                resetDTCScroll();  // Start at first DTC when opening page
                 // Keep DTC button highlighted after page change
                 current_button_index = BTN_NAV_DTC;
                 Serial.printf("[Button] Set current_button_index = %d (DTC)\n", current_button_index);
@@ -380,44 +512,70 @@ inline bool activateButton(Page& current_page, bool& page_needs_redraw, int dtc_
             return true;
 
         case BTN_NAV_CONFIG:
-            if (current_page != PAGE_CONFIG) {
+            if (current_page == PAGE_STATS && selectNextStatsView()) {
+                // SELECT on Config tab while on Stats: next view, Config after the last
+                Serial.printf("[Button] Stats view: %s\n", statsViewName(getStatsView()));
+                page_needs_redraw = true;
+            } else if (current_page != PAGE_CONFIG) {
                 Serial.println("[Button] Switching to Config page");
                 current_page = PAGE_CONFIG;
                 page_needs_redraw = true;
                 // Keep Config button highlighted after page change
                 current_button_index = BTN_NAV_CONFIG;
                 Serial.printf("[Button] Set current_button_index = %d (Config)\n", current_button_index);
+            } else {
+                // Hidden stats page: SELECT on Config tab while already on Config
+                Serial.println("[Button] Switching to Stats page");
+                resetStatsView();
+                current_page = PAGE_STATS;
+                page_needs_redraw = true;
             }
             return true;
 
         // DTC Actions
+        case BTN_DTC_DETAIL:
+            // Detail of the first code on screen, then the next code, list after the last
+            if (selectNextDTCDetail(dtc_count)) {
+                Serial.printf("[Button] DTC detail %d\n", getDTCDetailIndex(dtc_count) + 1);
+            } else {
+                Serial.println("[Button] DTC list");
+            }
+            page_needs_redraw = true;
+            return true;
+
         case BTN_DTC_REFRESH:
             Serial.println("[Button] Refresh DTCs requested");
-            // Set flag for OBD2 task to handle (thread-safe)
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            obd_data.dtc_refresh_requested = true;
-            xSemaphoreGive(data_mutex);
+            // Set flag for OBD2 task to handle (atomic)
+            obd_requests.dtc_refresh.store(true);
             return true;
 
         case BTN_DTC_CLEAR:
             Serial.println("[Button] Clear all DTCs requested");
-            // Set flag for OBD2 task to handle (thread-safe)
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            obd_data.dtc_clear_requested = true;
-            xSemaphoreGive(data_mutex);
+            // Set flag for OBD2 task to handle (atomic)
+            obd_requests.dtc_clear.store(true);
+            return true;
+
+        // Config Actions
+        case BTN_CONFIG_SPORT: {
+            // Read by the OBD2 task before its next poll (atomic)
+            bool sport = !obd_requests.sport_mode.load();
+            obd_requests.sport_mode.store(sport);
+            Serial.printf("[Button] Sport mode %s\n", sport ? "on" : "off");
+            page_needs_redraw = true;  // Button label and color
             return true;
+        }
 
         case BTN_DTC_UP:
             if (ui_buttons[BTN_DTC_UP].enabled) {
                 scrollDTCUp();
-                page_needs_redraw = true;
+                onDTCScrolled(current_page, dtc_count);
             }
             return true;
 
         case BTN_DTC_DOWN:
             if (ui_buttons[BTN_DTC_DOWN].enabled) {
                 scrollDTCDown(dtc_count);
-                page_needs_redraw = true;
+                onDTCScrolled(current_page, dtc_count);
             }
             return true;
 
@@ -427,7 +585,7 @@ inline bool activateButton(Page& current_page, bool& page_needs_redraw, int dtc_
 }
 
 /**
- * Handle physical button presses
+ * Handle button presses latched by the GPIO interrupts
  * @param current_page Current page reference (may be changed)
  * @param page_needs_redraw Redraw flag
  * @param dtc_count Current DTC count
@@ -435,15 +593,21 @@ inline bool activateButton(Page& current_page, bool& page_needs_redraw, int dtc_
 inline void handleButtonInput(Page& current_page, bool& page_needs_redraw, int dtc_count) {
     static unsigned long last_button_time = 0;
 
-    // Debounce - ignore button presses within 300ms
+    // Take latched presses (bounce edges collapse into one bit)
+    uint32_t pressed = buttonPressBits().exchange(0);
+    if (pressed == 0) {
+        return;
+    }
+
+    // Debounce - ignore button presses within DEBOUNCE_DELAY_MS
     if (millis() - last_button_time < DEBOUNCE_DELAY_MS) {
         return;
     }
 
-    // Check buttons (active LOW with pull-up resistors)
-    bool left_pressed = (digitalRead(BTN_LEFT) == LOW);
-    bool right_pressed = (digitalRead(BTN_RIGHT) == LOW);
-    bool select_pressed = (digitalRead(BTN_SELECT) == LOW);
+    // Edge must still read LOW (active LOW with pull-up resistors, drops noise spikes)
+    bool left_pressed = (pressed & BTN_PRESS_LEFT) && digitalRead(BTN_LEFT) == LOW;
+    bool right_pressed = (pressed & BTN_PRESS_RIGHT) && digitalRead(BTN_RIGHT) == LOW;
+    bool select_pressed = (pressed & BTN_PRESS_SELECT) && digitalRead(BTN_SELECT) == LOW;
 
     if (left_pressed) {
         navigatePreviousButton(current_page);
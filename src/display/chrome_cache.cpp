@@ -0,0 +1,127 @@
+/**
+ * Chrome Cache - Implementation
+ */
+
+#include "chrome_cache.h"
+#include "display_writer.h"
+#include "nav_bar.h"
+#include "dashboard.h"
+#include "config_page.h"
+#include "graph_page.h"
+
+// ============================================================================
+// PAGE CHROME
+// ============================================================================
+
+uint32_t chromeInfoTag(const VehicleInfo& info) {
+    // FNV-1a over the text fields the config page prints
+    uint32_t hash = 2166136261u;
+    const char* fields[] = {info.vin, info.adapter};
+    for (const char* field : fields) {
+        for (const char* c = field; *c != '\0'; c++) {
+            hash = (hash ^ (uint8_t)*c) * 16777619u;
+        }
+        hash = (hash ^ 0xFF) * 16777619u;  // Field separator
+    }
+    return (hash ^ (info.adapter_clone ? 1u : 0u)) * 16777619u;
+}
+
+void drawPageChrome(const PageChrome& chrome, TFT_eSPI& gfx) {
+    drawTopBar("OBDeck", chrome.page_name, chrome.status_color, chrome.dtc_count, gfx);
+    drawBottomNav(chrome.page, gfx);
+
+    if (!chrome.with_content) return;
+
+    // DTC list and stats counters change too often to cache - drawn by their pages
+    if (chrome.page == PAGE_DASHBOARD) {
+        drawDashboardFrames(chrome.layout_index, gfx);
+    } else if (chrome.page == PAGE_CONFIG) {
+        drawConfigPage(*chrome.info, chrome.sport_mode, gfx);
+    } else if (chrome.page == PAGE_GRAPH) {
+        drawGraphFrames(chrome.graph_signal, gfx);
+    }
+}
+
+// ============================================================================
+// FRAME CACHE
+// ============================================================================
+
+struct ChromeFrame {
+    TFT_eSprite* sprite;    // Full-screen frame (NULL = not allocated yet)
+    bool alloc_failed;      // Allocation failed once - page is drawn directly
+    bool valid;             // Frame holds the chrome described by key
+    PageChrome key;         // Chrome in the frame (pointers not compared)
+};
+
+static ChromeFrame frames[PAGE_COUNT];
+static bool cache_disabled = !DISPLAY_CHROME_CACHE;  // Disabled in config.h, or no PSRAM
+
+static bool sameChrome(const PageChrome& a, const PageChrome& b) {
+    return a.page == b.page &&
+           a.status_color == b.status_color &&
+           a.dtc_count == b.dtc_count &&
+           a.with_content == b.with_content &&
+           a.layout_index == b.layout_index &&
+           a.graph_signal == b.graph_signal &&
+           a.info_tag == b.info_tag &&
+           a.sport_mode == b.sport_mode &&
+           strcmp(a.page_name, b.page_name) == 0;
+}
+
+/**
+ * Get the frame of a page, allocating it in PSRAM on first use
+ * @return NULL if frames are unavailable (caller draws directly)
+ */
+static TFT_eSprite* getChromeFrame(Page page) {
+    if (cache_disabled || page >= PAGE_COUNT) return NULL;
+
+    ChromeFrame& frame = frames[page];
+    if (frame.sprite != NULL || frame.alloc_failed) return frame.sprite;
+
+    // A 480x320 frame does not fit into internal RAM - PSRAM or nothing
+    if (!psramFound()) {
+        Serial.println("[Display] No PSRAM - chrome cache disabled, drawing pages directly");
+        cache_disabled = true;
+        return NULL;
+    }
+
+    TFT_eSprite* sprite = new TFT_eSprite(&tft);
+    sprite->setColorDepth(16);
+    if (sprite->createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) == NULL) {
+        Serial.printf("[Display] Chrome frame for page %d allocation failed - drawing directly\n", page);
+        delete sprite;
+        frame.alloc_failed = true;
+        return NULL;
+    }
+
+    frame.sprite = sprite;
+    frame.valid = false;
+    Serial.printf("[Display] Chrome frame for page %d allocated (%u bytes PSRAM)\n",
+                  page, (unsigned)(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t)));
+    return sprite;
+}
+
+void showPageChrome(const PageChrome& chrome) {
+    TFT_eSprite* sprite = getChromeFrame(chrome.page);
+
+    if (sprite == NULL) {
+        // Clear screen first (paced fill to avoid power spike), then draw call by draw call
+        displayFillScreen(COLOR_BLACK);
+        drawPageChrome(chrome, tft);
+        return;
+    }
+
+    // Stale frame: render off-screen (CPU and PSRAM only, nothing reaches the panel)
+    ChromeFrame& frame = frames[chrome.page];
+    if (!frame.valid || !sameChrome(frame.key, chrome)) {
+        uint32_t start = micros();
+        sprite->fillSprite(COLOR_BLACK);
+        drawPageChrome(chrome, *sprite);
+        frame.key = chrome;
+        frame.valid = true;
+        Serial.printf("[Display] Chrome for page %d rendered in %lu us\n",
+                      chrome.page, (unsigned long)(micros() - start));
+    }
+
+    displayPushImage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, (const uint16_t*)sprite->getPointer());
+}
@@ -0,0 +1,61 @@
+/**
+ * Chrome Cache - Static page background restored from off-screen frames
+ *
+ * A full redraw used to clear the screen in strips and rebuild the top bar,
+ * bottom nav, gauge boxes and config text draw call by draw call. The static
+ * part of each page (its "chrome") is now rendered once into a full-screen
+ * frame in PSRAM and blitted back as one windowed transfer:
+ * - One frame per page, tagged with everything the chrome shows
+ * - A stale frame (page name, status, DTC count, layout, graph signal, VIN/adapter,
+ *   sport mode)
+ *   is re-rendered off-screen, then blitted - no extra panel writes
+ * - Without PSRAM (a frame is 300 KB) the chrome is drawn directly as before
+ *
+ * Only the display task may call these functions.
+ */
+
+#ifndef CHROME_CACHE_H
+#define CHROME_CACHE_H
+
+#include "ui_common.h"
+#include "../obd2/obd_data.h"
+
+/**
+ * Everything the static background of a page depends on
+ */
+struct PageChrome {
+    Page page;                  // Page (selects nav highlight and static content)
+    const char* page_name;      // Top bar title
+    uint16_t status_color;      // Top bar status indicator
+    uint8_t dtc_count;          // Top bar DTC count
+    bool with_content;          // Include static page content (connected screens only)
+    uint8_t layout_index;       // Dashboard layout (gauge boxes)
+    uint8_t graph_signal;       // Graph page signal (axis labels)
+    uint32_t info_tag;          // Fingerprint of the config page text (VIN, adapter)
+    bool sport_mode;            // Config page sport mode button state
+    const VehicleInfo* info;    // Config page text source
+};
+
+/**
+ * Fingerprint of the vehicle info shown on the config page
+ * @param info Vehicle info snapshot
+ * @return Hash that changes when VIN or adapter text changes
+ */
+uint32_t chromeInfoTag(const VehicleInfo& info);
+
+/**
+ * Draw a page's chrome on a black background
+ * @param chrome Chrome description
+ * @param gfx Draw target (panel, or a cache frame)
+ */
+void drawPageChrome(const PageChrome& chrome, TFT_eSPI& gfx);
+
+/**
+ * Replace the whole screen with a page's chrome
+ * Blits the cached frame; renders it off-screen first if stale,
+ * clears and draws directly if no frame could be allocated
+ * @param chrome Chrome description
+ */
+void showPageChrome(const PageChrome& chrome);
+
+#endif // CHROME_CACHE_H
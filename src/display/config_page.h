@@ -6,103 +6,130 @@
 #define CONFIG_PAGE_H
 
 #include "ui_common.h"
+#include "display_writer.h"
 #include "../obd2/obd_data.h"
 
 /**
- * Draw configuration page with 3-section layout
- * Layout: Vehicle Info (top-left), Bluetooth (bottom-left), Display (top-right)
+ * Draw configuration page with 4-section layout
+ * Layout: Vehicle Info (top-left), Bluetooth (bottom-left), Display (top-right),
+ * Polling with the sport mode button (bottom-right)
+ * @param info Vehicle info snapshot (VIN, adapter)
+ * @param sport_mode Sport mode selected (button label and color)
+ * @param gfx Draw target (panel, or the chrome cache frame)
  */
-inline void drawConfigPage() {
+inline void drawConfigPage(const VehicleInfo& info, bool sport_mode, TFT_eSPI& gfx = tft) {
     // Left column X position, Right column X position
     const int LEFT_X = 10;
     const int RIGHT_X = 250;
     const int TOP_Y = CONTENT_Y_START + 10;
     const int BOTTOM_Y = CONTENT_Y_START + 130;
 
-    // Get VIN from shared data (with safety check)
-    char vin[18] = "Loading...";
-    if (data_mutex != NULL) {
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        if (obd_data.vin[0] != '\0') {
-            strncpy(vin, obd_data.vin, sizeof(vin) - 1);
-            vin[17] = '\0';
-        }
-        xSemaphoreGive(data_mutex);
-    }
+    // VIN from snapshot (not queried yet right after startup)
+    const char* vin = (info.vin[0] != '\0') ? info.vin : "Loading...";
 
     // ========================================
     // VEHICLE INFO (Top Left)
     // ========================================
     int y = TOP_Y;
-    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft.setTextSize(1);
-    tft.setTextDatum(TL_DATUM);
-    tft.drawString("Vehicle Information", LEFT_X, y);
+    gfx.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    gfx.setTextSize(1);
+    gfx.setTextDatum(TL_DATUM);
+    gfx.drawString("Vehicle Information", LEFT_X, y);
 
     y += 20;
-    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft.drawString("Make/Model:", LEFT_X, y);
-    tft.drawString(VEHICLE_NAME, LEFT_X + 10, y + 12);
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.drawString("Make/Model:", LEFT_X, y);
+    gfx.drawString(VEHICLE_NAME, LEFT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("Year:", LEFT_X, y);
+    gfx.drawString("Year:", LEFT_X, y);
     char year_str[8];
     snprintf(year_str, sizeof(year_str), "%d", VEHICLE_YEAR);
-    tft.drawString(year_str, LEFT_X + 10, y + 12);
+    gfx.drawString(year_str, LEFT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("VIN:", LEFT_X, y);
-    tft.drawString(vin, LEFT_X + 10, y + 12);
+    gfx.drawString("VIN:", LEFT_X, y);
+    gfx.drawString(vin, LEFT_X + 10, y + 12);
 
     // ========================================
     // BLUETOOTH (Bottom Left)
     // ========================================
     y = BOTTOM_Y;
-    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft.setTextSize(1);
-    tft.drawString("Bluetooth Settings", LEFT_X, y);
+    gfx.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    gfx.setTextSize(1);
+    gfx.drawString("Bluetooth Settings", LEFT_X, y);
 
     y += 20;
-    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft.drawString("MAC Address:", LEFT_X, y);
-    tft.drawString(BT_MAC_ADDRESS, LEFT_X + 10, y + 12);
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.drawString("MAC Address:", LEFT_X, y);
+    gfx.drawString(BT_MAC_ADDRESS, LEFT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("Status:", LEFT_X, y);
-    tft.drawString("Connected", LEFT_X + 10, y + 12);
+    gfx.drawString("Status:", LEFT_X, y);
+    gfx.drawString("Connected", LEFT_X + 10, y + 12);
+
+    y += 30;
+    gfx.drawString("Adapter:", LEFT_X, y);
+    char adapter_str[40];
+    snprintf(adapter_str, sizeof(adapter_str), "%s%s",
+             info.adapter[0] != '\0' ? info.adapter : "Unknown",
+             info.adapter_clone ? " (clone)" : "");
+    gfx.drawString(adapter_str, LEFT_X + 10, y + 12);
 
     // ========================================
     // DISPLAY (Top Right)
     // ========================================
     y = TOP_Y;
-    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft.setTextSize(1);
-    tft.drawString("Display Settings", RIGHT_X, y);
+    gfx.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    gfx.setTextSize(1);
+    gfx.drawString("Display Settings", RIGHT_X, y);
 
     y += 20;
-    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft.drawString("Resolution:", RIGHT_X, y);
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.drawString("Resolution:", RIGHT_X, y);
     char res_str[16];
     snprintf(res_str, sizeof(res_str), "%dx%d", SCREEN_WIDTH, SCREEN_HEIGHT);
-    tft.drawString(res_str, RIGHT_X + 10, y + 12);
+    gfx.drawString(res_str, RIGHT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("Refresh Rate:", RIGHT_X, y);
-    char hz_str[16];
-    // Calculate actual refresh rate from DISPLAY_REFRESH_MS
-    float actual_hz = 1000.0f / DISPLAY_REFRESH_MS;
-    snprintf(hz_str, sizeof(hz_str), "%.1f Hz", actual_hz);
-    tft.drawString(hz_str, RIGHT_X + 10, y + 12);
+    gfx.drawString("Refresh Rate:", RIGHT_X, y);
+    // Frames are event-driven (drawn when a shown value changes)
+    gfx.drawString("On change", RIGHT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("SPI Frequency:", RIGHT_X, y);
+    gfx.drawString("SPI Frequency:", RIGHT_X, y);
     char spi_str[16];
     snprintf(spi_str, sizeof(spi_str), "%d MHz", SPI_FREQUENCY / 1000000);
-    tft.drawString(spi_str, RIGHT_X + 10, y + 12);
+    gfx.drawString(spi_str, RIGHT_X + 10, y + 12);
 
     y += 30;
-    tft.drawString("Controller:", RIGHT_X, y);
-    tft.drawString("ILI9488", RIGHT_X + 10, y + 12);
+    gfx.drawString("Controller:", RIGHT_X, y);
+    gfx.drawString("ILI9488", RIGHT_X + 10, y + 12);
+
+    // ========================================
+    // POLLING (Bottom Right)
+    // ========================================
+    y = BOTTOM_Y + 20;
+    gfx.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    gfx.setTextSize(1);
+    gfx.drawString("Polling", RIGHT_X, y);
+
+    y += 12;
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.drawString(sport_mode ? "RPM, throttle, speed only" : "All PIDs (adaptive rates)",
+                   RIGHT_X, y);
+
+    // Sport mode button (ui_buttons[BTN_CONFIG_SPORT], highlight drawn by button_nav.h)
+    uint16_t btn_color = sport_mode ? COLOR_ORANGE : COLOR_DARKGRAY;
+    displayFillRectOn(gfx, RIGHT_X, BOTTOM_Y + 45, 200, 38, btn_color);
+    gfx.drawRect(RIGHT_X, BOTTOM_Y + 45, 200, 38, COLOR_WHITE);
+    gfx.setTextColor(COLOR_WHITE, btn_color);
+    gfx.setTextSize(2);
+    gfx.drawString(sport_mode ? "SPORT: ON" : "SPORT: OFF", RIGHT_X + 12, BOTTOM_Y + 56);
+
+    // Reset text settings to prevent corruption
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.setTextSize(1);
 }
 
 #endif // CONFIG_PAGE_H
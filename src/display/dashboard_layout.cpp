@@ -0,0 +1,257 @@
+/**
+ * Dashboard Layouts - Implementation
+ */
+
+#include "dashboard_layout.h"
+#include "ui_common.h"
+#include <atomic>
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+
+// ============================================================================
+// METRIC CATALOG
+// ============================================================================
+
+const DashboardGauge dashboard_gauges[DASH_METRIC_COUNT] = {
+    {"rpm",              "RPM",            "",  0},
+    {"speed",            "Speed (km/h)",   "",  0},
+    {"coolant",          "Coolant (C)",    "",  1},
+    {"throttle",         "Throttle",       "%", 0},
+    {"battery",          "Battery",        "V", 1},
+    {"intake",           "Intake (C)",     "",  1},
+    {"fuel_rate",        "Fuel (L/h)",     "",  1},
+    {"consumption",      "Now (L/100km)",  "",  1},
+    {"trip_consumption", "Trip (L/100km)", "",  1},
+    {"load",             "Load",           "%", 0},
+    {"boost",            "Boost (kPa)",    "",  0},
+};
+
+// ============================================================================
+// BUILT-IN LAYOUTS
+// ============================================================================
+
+static constexpr DashboardLayout builtin_layouts[] = {
+    // Overview: all six metrics, 2x3 grid
+    {"Dashboard", 2, 3, 6, {
+        {DASH_RPM,      0, 0, 1, 1, 3, 0},
+        {DASH_SPEED,    1, 0, 1, 1, 3, 0},
+        {DASH_COOLANT,  0, 1, 1, 1, 3, 1000},
+        {DASH_THROTTLE, 1, 1, 1, 1, 3, 0},
+        {DASH_BATTERY,  0, 2, 1, 1, 3, 1000},
+        {DASH_INTAKE,   1, 2, 1, 1, 3, 1000},
+    }},
+    // Drive: large RPM and speed, throttle and coolant below
+    {"Drive", 2, 3, 4, {
+        {DASH_RPM,      0, 0, 1, 2, 5, 0},
+        {DASH_SPEED,    1, 0, 1, 2, 5, 0},
+        {DASH_THROTTLE, 0, 2, 1, 1, 3, 0},
+        {DASH_COOLANT,  1, 2, 1, 1, 3, 1000},
+    }},
+    // Temps: engine temperatures and battery, slow refresh
+    {"Temps", 2, 2, 3, {
+        {DASH_COOLANT,  0, 0, 1, 1, 4, 1000},
+        {DASH_INTAKE,   1, 0, 1, 1, 4, 1000},
+        {DASH_BATTERY,  0, 1, 2, 1, 4, 1000},
+    }},
+    // Economy: derived fuel values (computed on Core 0), load and boost
+    {"Economy", 2, 3, 6, {
+        {DASH_CONSUMPTION,      0, 0, 1, 1, 4, 500},
+        {DASH_TRIP_CONSUMPTION, 1, 0, 1, 1, 4, 1000},
+        {DASH_FUEL_RATE,        0, 1, 1, 1, 3, 500},
+        {DASH_LOAD,             1, 1, 1, 1, 3, 0},
+        {DASH_BOOST,            0, 2, 1, 1, 3, 0},
+        {DASH_SPEED,            1, 2, 1, 1, 3, 0},
+    }},
+};
+
+// Sport mode: only the polled PIDs (SPORT_MODE_PIDS), redrawn on every change
+static constexpr DashboardLayout sport_layout =
+    {"Sport", 2, 3, 3, {
+        {DASH_RPM,      0, 0, 2, 2, 8, 0},
+        {DASH_SPEED,    0, 2, 1, 1, 5, 0},
+        {DASH_THROTTLE, 1, 2, 1, 1, 5, 0},
+    }};
+static_assert(DASHBOARD_MAX_VALUE_SIZE >= 8, "Sport layout RPM uses value size 8");
+
+static constexpr uint8_t BUILTIN_LAYOUT_COUNT = sizeof(builtin_layouts) / sizeof(builtin_layouts[0]);
+static_assert(BUILTIN_LAYOUT_COUNT <= DASHBOARD_MAX_LAYOUTS, "Too many built-in layouts");
+
+// ============================================================================
+// LAYOUT STATE
+// ============================================================================
+
+// Active layouts (built-in copy or JSON), written once before the display task starts
+static DashboardLayout layouts[DASHBOARD_MAX_LAYOUTS];
+static uint8_t layout_count = 0;
+
+// Selected by the input loop, read by the display task on full redraws
+static std::atomic<uint8_t> active_layout(0);
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+// Label (text size 2) plus gap above the value cell (see metric_widget.h)
+#define DASHBOARD_LABEL_AREA    30
+
+DirtyRect computeDashboardCellRect(const DashboardLayout& layout, const DashboardCell& cell) {
+    const int margin = DASHBOARD_CELL_MARGIN;
+    const int cell_w = (SCREEN_WIDTH - (layout.cols + 1) * margin) / layout.cols;
+    const int cell_h = (CONTENT_HEIGHT - (layout.rows + 1) * margin) / layout.rows;
+
+    DirtyRect r;
+    r.x = margin + cell.col * (cell_w + margin);
+    r.y = CONTENT_Y_START + margin + cell.row * (cell_h + margin);
+    r.w = cell.col_span * cell_w + (cell.col_span - 1) * margin;
+    r.h = cell.row_span * cell_h + (cell.row_span - 1) * margin;
+    return r;
+}
+
+/**
+ * Check cell against its grid and clamp the font to the box height
+ * @return true if the cell can be drawn
+ */
+static bool validateCell(const DashboardLayout& layout, DashboardCell& cell) {
+    if (cell.metric >= DASH_METRIC_COUNT) return false;
+    if (cell.col_span == 0 || cell.row_span == 0) return false;
+    if (cell.col + cell.col_span > layout.cols) return false;
+    if (cell.row + cell.row_span > layout.rows) return false;
+
+    if (cell.value_size < 1) cell.value_size = 1;
+    if (cell.value_size > DASHBOARD_MAX_VALUE_SIZE) cell.value_size = DASHBOARD_MAX_VALUE_SIZE;
+
+    // Value cell (8 px glyphs + 4 px) must fit below the label
+    DirtyRect rect = computeDashboardCellRect(layout, cell);
+    while (cell.value_size > 1 &&
+           DASHBOARD_LABEL_AREA + cell.value_size * 8 + 4 > rect.h) {
+        cell.value_size--;
+    }
+    return true;
+}
+
+// ============================================================================
+// JSON LOADING
+// ============================================================================
+
+/**
+ * Find metric by JSON name
+ * @return DashboardMetric, or DASH_METRIC_COUNT if unknown
+ */
+static uint8_t findMetric(const char* name) {
+    if (name == NULL) return DASH_METRIC_COUNT;
+    for (uint8_t i = 0; i < DASH_METRIC_COUNT; i++) {
+        if (strcmp(dashboard_gauges[i].name, name) == 0) return i;
+    }
+    return DASH_METRIC_COUNT;
+}
+
+/**
+ * Clamp grid dimension to 1..DASHBOARD_MAX_GRID
+ */
+static uint8_t clampGrid(int value) {
+    if (value < 1) return 1;
+    if (value > DASHBOARD_MAX_GRID) return DASHBOARD_MAX_GRID;
+    return value;
+}
+
+/**
+ * Parse layouts from DASHBOARD_LAYOUT_FILE into the layout table
+ * @return Number of valid layouts (0 = file missing or unusable)
+ */
+static uint8_t loadLayoutFile() {
+    if (!LittleFS.begin(false) || !LittleFS.exists(DASHBOARD_LAYOUT_FILE)) {
+        return 0;
+    }
+
+    File file = LittleFS.open(DASHBOARD_LAYOUT_FILE, FILE_READ);
+    if (!file) return 0;
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (error) {
+        Serial.printf("[Layout] %s: %s - using built-in layouts\n", DASHBOARD_LAYOUT_FILE, error.c_str());
+        return 0;
+    }
+
+    uint8_t count = 0;
+    JsonArray list = doc["layouts"];
+    for (JsonObject entry : list) {
+        if (count >= DASHBOARD_MAX_LAYOUTS) break;
+
+        DashboardLayout& layout = layouts[count];
+        snprintf(layout.name, sizeof(layout.name), "%s", (const char*)(entry["name"] | "Custom"));
+        layout.cols = clampGrid(entry["cols"] | 2);
+        layout.rows = clampGrid(entry["rows"] | 3);
+        layout.cell_count = 0;
+
+        JsonArray cells = entry["cells"];
+        for (JsonObject item : cells) {
+            if (layout.cell_count >= DASHBOARD_MAX_CELLS) break;
+
+            DashboardCell cell;
+            cell.metric = findMetric(item["metric"] | (const char*)NULL);
+            cell.col = item["col"] | 0;
+            cell.row = item["row"] | 0;
+            cell.col_span = item["w"] | 1;
+            cell.row_span = item["h"] | 1;
+            cell.value_size = item["size"] | 3;
+            cell.update_ms = item["update_ms"] | 0;
+
+            if (validateCell(layout, cell)) {
+                layout.cells[layout.cell_count++] = cell;
+            } else {
+                Serial.printf("[Layout] %s: skipping invalid cell (%s)\n", layout.name,
+                              (const char*)(item["metric"] | "?"));
+            }
+        }
+
+        if (layout.cell_count > 0) count++;
+    }
+
+    return count;
+}
+
+// ============================================================================
+// LAYOUT API
+// ============================================================================
+
+void loadDashboardLayouts() {
+    layout_count = loadLayoutFile();
+
+    if (layout_count > 0) {
+        Serial.printf("✓ Dashboard layouts loaded from %s (%d)\n", DASHBOARD_LAYOUT_FILE, layout_count);
+    } else {
+        for (uint8_t i = 0; i < BUILTIN_LAYOUT_COUNT; i++) {
+            layouts[i] = builtin_layouts[i];
+            for (uint8_t c = 0; c < layouts[i].cell_count; c++) {
+                validateCell(layouts[i], layouts[i].cells[c]);
+            }
+        }
+        layout_count = BUILTIN_LAYOUT_COUNT;
+        Serial.printf("✓ Dashboard layouts: %d built-in\n", layout_count);
+    }
+    active_layout.store(0);
+}
+
+uint8_t getDashboardLayoutCount() {
+    return layout_count > 0 ? layout_count : 1;
+}
+
+const DashboardLayout& getDashboardLayout(uint8_t index) {
+    if (index == DASHBOARD_SPORT_LAYOUT) return sport_layout;
+    if (layout_count == 0) return builtin_layouts[0];
+    return layouts[index % layout_count];
+}
+
+uint8_t getActiveDashboardLayout() {
+    return active_layout.load();
+}
+
+void selectNextDashboardLayout() {
+    active_layout.store((active_layout.load() + 1) % getDashboardLayoutCount());
+}
+
+void setActiveDashboardLayout(uint8_t index) {
+    active_layout.store(index % getDashboardLayoutCount());
+}
@@ -0,0 +1,145 @@
+/**
+ * Dashboard Layouts - Data-driven gauge pages
+ *
+ * A layout maps metrics to grid cells (position, span, font size, update rate).
+ * Built-in layouts are compiled in as a constexpr table; a JSON file on LittleFS
+ * (DASHBOARD_LAYOUT_FILE) replaces them if present and valid:
+ *
+ *   {"layouts": [{"name": "Drive", "cols": 2, "rows": 3, "cells": [
+ *       {"metric": "rpm", "col": 0, "row": 0, "w": 1, "h": 2, "size": 5},
+ *       {"metric": "coolant", "col": 0, "row": 2, "update_ms": 1000}, ...]}]}
+ *
+ * Cell rectangles are computed once per layout (dashboard.h), never per frame.
+ * SELECT on the Dashboard tab while on the Dashboard cycles through layouts
+ * (past the last one it opens the graph page, graph_page.h).
+ *
+ * Sport mode replaces the cycle with one fixed large-digit layout
+ * (DASHBOARD_SPORT_LAYOUT) showing only the PIDs sport mode polls.
+ */
+
+#ifndef DASHBOARD_LAYOUT_H
+#define DASHBOARD_LAYOUT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "dirty_rect.h"
+#include "../obd2/obd_data.h"
+
+// ============================================================================
+// METRIC CATALOG
+// ============================================================================
+
+enum DashboardMetric : uint8_t {
+    DASH_RPM = 0,
+    DASH_SPEED,
+    DASH_COOLANT,
+    DASH_THROTTLE,
+    DASH_BATTERY,
+    DASH_INTAKE,
+    DASH_FUEL_RATE,
+    DASH_CONSUMPTION,
+    DASH_TRIP_CONSUMPTION,
+    DASH_LOAD,
+    DASH_BOOST,
+    DASH_METRIC_COUNT
+};
+
+struct DashboardGauge {
+    const char* name;       // JSON key, e.g. "coolant"
+    const char* label;      // Box label, e.g. "Coolant (C)"
+    const char* suffix;     // Appended to the value ("%", "V" or "")
+    uint8_t decimals;       // Fixed-point display precision
+};
+
+extern const DashboardGauge dashboard_gauges[DASH_METRIC_COUNT];
+
+/**
+ * Live value shown by a metric
+ */
+inline float dashboardValue(const LiveData& data, uint8_t metric) {
+    switch (metric) {
+        case DASH_RPM:               return data.rpm;
+        case DASH_SPEED:             return data.speed;
+        case DASH_COOLANT:           return data.coolant_temp;
+        case DASH_THROTTLE:          return data.throttle;
+        case DASH_BATTERY:           return data.battery_voltage;
+        case DASH_INTAKE:            return data.intake_temp;
+        case DASH_FUEL_RATE:         return data.fuel_rate;
+        case DASH_CONSUMPTION:       return data.consumption;
+        case DASH_TRIP_CONSUMPTION:  return data.trip_consumption;
+        case DASH_LOAD:              return data.engine_load;
+        case DASH_BOOST:             return data.boost;
+        default:                     return 0;
+    }
+}
+
+// ============================================================================
+// LAYOUT DESCRIPTION
+// ============================================================================
+
+struct DashboardCell {
+    uint8_t metric;         // DashboardMetric
+    uint8_t col, row;       // Top-left grid cell
+    uint8_t col_span;       // Width in grid cells
+    uint8_t row_span;       // Height in grid cells
+    uint8_t value_size;     // GLCD text size of the value (1..DASHBOARD_MAX_VALUE_SIZE)
+    uint16_t update_ms;     // Minimum time between value redraws (0 = every change)
+};
+
+struct DashboardLayout {
+    char name[12];          // Shown in the top bar
+    uint8_t cols, rows;     // Grid size
+    uint8_t cell_count;
+    DashboardCell cells[DASHBOARD_MAX_CELLS];
+};
+
+// Index of the sport mode layout (outside the cycled layouts, not replaced by the file)
+#define DASHBOARD_SPORT_LAYOUT  DASHBOARD_MAX_LAYOUTS
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Load layouts from DASHBOARD_LAYOUT_FILE, or use the built-in table
+ * Invalid cells are skipped, layouts without valid cells are dropped
+ * Call once before the display task starts
+ */
+void loadDashboardLayouts();
+
+/**
+ * @return Number of available layouts (at least 1)
+ */
+uint8_t getDashboardLayoutCount();
+
+/**
+ * @param index Layout index (wrapped to the available count), or DASHBOARD_SPORT_LAYOUT
+ * @return Layout description
+ */
+const DashboardLayout& getDashboardLayout(uint8_t index);
+
+/**
+ * Screen rectangle of a cell (content area grid with DASHBOARD_CELL_MARGIN gaps)
+ * @param layout Layout the cell belongs to
+ * @param cell Cell description
+ * @return Box rectangle in screen coordinates
+ */
+DirtyRect computeDashboardCellRect(const DashboardLayout& layout, const DashboardCell& cell);
+
+/**
+ * @return Index of the layout shown on the dashboard page
+ */
+uint8_t getActiveDashboardLayout();
+
+/**
+ * Switch to the next layout (input loop; caller requests the page redraw)
+ */
+void selectNextDashboardLayout();
+
+/**
+ * Show a layout by index, e.g. the one restored at boot (wrapped to the available count)
+ * Call after loadDashboardLayouts()
+ */
+void setActiveDashboardLayout(uint8_t index);
+
+#endif // DASHBOARD_LAYOUT_H
@@ -0,0 +1,135 @@
+/**
+ * Digit Atlas - Pre-rendered anti-aliased numerals for value cells
+ *
+ * Scaling the GLCD font with setTextSize() draws every bitmap pixel as a
+ * size x size block, with hard stair steps on the diagonals. The atlas
+ * holds the value characters (digit_glyphs.h) rasterized once per text size:
+ * - Coverage maps (1 byte per pixel) in PSRAM, internal RAM as fallback,
+ *   built on first use of a size (sizes below DIGIT_ATLAS_MIN_SIZE keep GLCD)
+ * - A value is composed into the value sprite by blending the coverage
+ *   with a 17-entry color ramp, so the dirty rectangle still goes out as
+ *   one window write (value_renderer.h)
+ *
+ * Only the display task may call these functions.
+ */
+
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#include <esp_heap_caps.h>
+#include "ui_common.h"
+#include "digit_glyphs.h"
+
+#define DIGIT_ATLAS_MIN_SIZE    2      // Smaller text is drawn with the GLCD font
+
+struct DigitAtlas {
+    uint8_t* coverage;                      // All glyphs of one size, back to back
+    uint32_t offset[DIGIT_GLYPH_COUNT];     // Start of each glyph in coverage
+    bool failed;                            // Allocation failed - size uses GLCD text
+};
+
+/**
+ * Atlas of one text size, rasterized on first use
+ * @return NULL if the atlas is disabled, the size is out of range or RAM ran out
+ */
+inline const DigitAtlas* getDigitAtlas(uint8_t size) {
+    static DigitAtlas atlases[DASHBOARD_MAX_VALUE_SIZE + 1];
+
+    if (!DISPLAY_DIGIT_ATLAS || size < DIGIT_ATLAS_MIN_SIZE || size > DASHBOARD_MAX_VALUE_SIZE) {
+        return NULL;
+    }
+
+    DigitAtlas& atlas = atlases[size];
+    if (atlas.coverage != NULL) return &atlas;
+    if (atlas.failed) return NULL;
+
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < DIGIT_GLYPH_COUNT; i++) {
+        atlas.offset[i] = bytes;
+        bytes += digitGlyphBytes(digit_glyphs[i], size);
+    }
+
+    uint8_t* block = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (block == NULL) {
+        block = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    }
+    if (block == NULL) {
+        Serial.printf("[Display] Digit atlas size %d (%u bytes) allocation failed - using GLCD text\n",
+                      size, (unsigned)bytes);
+        atlas.failed = true;
+        return NULL;
+    }
+
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < DIGIT_GLYPH_COUNT; i++) {
+        rasterizeDigitGlyph(digit_glyphs[i], size, block + atlas.offset[i]);
+    }
+    atlas.coverage = block;
+    Serial.printf("[Display] Digit atlas size %d: %u bytes, rendered in %lu us\n",
+                  size, (unsigned)bytes, (unsigned long)(micros() - start));
+    return &atlas;
+}
+
+/**
+ * Color ramp from black to a color, in sprite byte order
+ * @param color Text color (RGB565)
+ * @param ramp Output, index = coverage 0..DIGIT_COVERAGE_MAX
+ */
+inline void buildDigitRamp(uint16_t color, uint16_t* ramp) {
+    uint16_t r = color >> 11;
+    uint16_t g = (color >> 5) & 0x3F;
+    uint16_t b = color & 0x1F;
+
+    for (uint8_t a = 0; a <= DIGIT_COVERAGE_MAX; a++) {
+        uint16_t blended = (uint16_t)((((r * a + DIGIT_COVERAGE_MAX / 2) / DIGIT_COVERAGE_MAX) << 11) |
+                                      (((g * a + DIGIT_COVERAGE_MAX / 2) / DIGIT_COVERAGE_MAX) << 5) |
+                                      ((b * a + DIGIT_COVERAGE_MAX / 2) / DIGIT_COVERAGE_MAX));
+        ramp[a] = (uint16_t)((blended >> 8) | (blended << 8));
+    }
+}
+
+/**
+ * Compose text from the atlas into a 16-bit pixel buffer (black background)
+ * Writes each glyph with its gap column; pixels outside the buffer are clipped
+ * @param pixels Buffer (sprite format, row-major)
+ * @param buf_w Buffer width (stride)
+ * @param buf_h Buffer height
+ * @param x Left edge of the text in the buffer
+ * @param text Text (digitTextCovered() must be true)
+ * @param size Text size
+ * @param color Text color
+ * @return false if no atlas is available for the size (nothing written)
+ */
+inline bool drawDigitText(uint16_t* pixels, int16_t buf_w, int16_t buf_h, int16_t x,
+                          const char* text, uint8_t size, uint16_t color) {
+    const DigitAtlas* atlas = getDigitAtlas(size);
+    if (atlas == NULL) return false;
+
+    uint16_t ramp[DIGIT_COVERAGE_MAX + 1];
+    buildDigitRamp(color, ramp);
+
+    const int16_t h = DIGIT_CELL_ROWS * size;
+    const int16_t rows = h < buf_h ? h : buf_h;
+
+    for (const char* c = text; *c != '\0'; c++) {
+        int8_t index = digitGlyphIndex(*c);
+        const DigitGlyph& glyph = digit_glyphs[index];
+        const uint8_t* coverage = atlas->coverage + atlas->offset[index];
+        const int16_t glyph_w = glyph.width * size;
+        const int16_t advance = glyph_w + size;
+
+        for (int16_t row = 0; row < rows; row++) {
+            uint16_t* line = pixels + row * buf_w;
+            const uint8_t* source = coverage + row * glyph_w;
+            for (int16_t col = 0; col < advance; col++) {
+                int16_t px = x + col;
+                if (px < 0 || px >= buf_w) continue;
+                line[px] = col < glyph_w ? ramp[source[col]] : ramp[0];
+            }
+        }
+        x += advance;
+    }
+    return true;
+}
+
+#endif // DIGIT_ATLAS_H
@@ -0,0 +1,157 @@
+/**
+ * Digit Glyphs - Metrics and anti-aliased rasterization of value numerals
+ *
+ * The characters metricFormat() produces (0-9 . - % V) as 5x7 bitmaps in
+ * the GLCD cell (6 x 8 at text size 1, one blank column and row):
+ * - Text width is summed from the glyph advances ('.' is narrower than the
+ *   fixed GLCD cell), not guessed from the character count
+ * - Rasterized at a target text size with diagonal joints smoothed and
+ *   4 x 4 supersampling: coverage 0..DIGIT_COVERAGE_MAX per pixel
+ *
+ * No TFT dependencies (shared by digit_atlas.h and the host benchmarks)
+ */
+
+#ifndef DIGIT_GLYPHS_H
+#define DIGIT_GLYPHS_H
+
+#include <stdint.h>
+#include <string.h>
+#include "metric_format.h"
+
+#define DIGIT_GLYPH_ROWS        7      // Bitmap rows (row 8 of the GLCD cell stays blank)
+#define DIGIT_CELL_ROWS         8      // GLCD cell height at text size 1
+#define DIGIT_SUPERSAMPLE       4      // Samples per pixel and axis
+#define DIGIT_COVERAGE_MAX      (DIGIT_SUPERSAMPLE * DIGIT_SUPERSAMPLE)
+
+struct DigitGlyph {
+    char ch;
+    uint8_t width;                      // Bitmap columns (advance = width + 1)
+    uint8_t rows[DIGIT_GLYPH_ROWS];     // Row bits, MSB = leftmost column
+};
+
+static const DigitGlyph digit_glyphs[] = {
+    {'0', 5, {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}},
+    {'1', 5, {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'2', 5, {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}},
+    {'3', 5, {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}},
+    {'4', 5, {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}},
+    {'5', 5, {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}},
+    {'6', 5, {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}},
+    {'7', 5, {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}},
+    {'8', 5, {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}},
+    {'9', 5, {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}},
+    {'.', 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03}},
+    {'-', 5, {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}},
+    {'%', 5, {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}},
+    {'V', 5, {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}},
+};
+
+#define DIGIT_GLYPH_COUNT   (sizeof(digit_glyphs) / sizeof(digit_glyphs[0]))
+
+/**
+ * @return Index in digit_glyphs, or -1 if the character has no glyph
+ */
+inline int8_t digitGlyphIndex(char c) {
+    if (c >= '0' && c <= '9') return (int8_t)(c - '0');
+    for (uint8_t i = 10; i < DIGIT_GLYPH_COUNT; i++) {
+        if (digit_glyphs[i].ch == c) return (int8_t)i;
+    }
+    return -1;
+}
+
+/**
+ * Whether every character of a text has a glyph
+ */
+inline bool digitTextCovered(const char* text) {
+    for (const char* c = text; *c != '\0'; c++) {
+        if (digitGlyphIndex(*c) < 0) return false;
+    }
+    return true;
+}
+
+/**
+ * Width of a text from the glyph advances
+ * Texts with characters outside the set are measured as GLCD text
+ * (fixed METRIC_GLYPH_WIDTH advance), since they are drawn with that font
+ * @param text Text to measure
+ * @param size Text size
+ * @return Width in pixels
+ */
+inline int16_t digitTextWidth(const char* text, uint8_t size) {
+    if (!digitTextCovered(text)) {
+        return (int16_t)(strlen(text) * METRIC_GLYPH_WIDTH * size);
+    }
+    int16_t width = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        width += (digit_glyphs[digitGlyphIndex(*c)].width + 1) * size;
+    }
+    return width;
+}
+
+/**
+ * Bitmap pixel (clear outside the glyph)
+ */
+inline bool digitGlyphPixel(const DigitGlyph& glyph, int col, int row) {
+    if (col < 0 || row < 0 || col >= glyph.width || row >= DIGIT_GLYPH_ROWS) return false;
+    return (glyph.rows[row] >> (glyph.width - 1 - col)) & 1;
+}
+
+/**
+ * Whether a point of the glyph (bitmap units) is inked
+ * A clear pixel whose two neighbours at one corner are set, with the pixel
+ * diagonally across that corner clear, is half filled towards the corner:
+ * diagonal strokes become solid 45 degree bands instead of touching squares.
+ */
+inline bool digitGlyphInside(const DigitGlyph& glyph, float x, float y) {
+    int col = (int)x;
+    int row = (int)y;
+    if (digitGlyphPixel(glyph, col, row)) return true;
+
+    float u = x - col;
+    float v = y - row;
+    bool left = digitGlyphPixel(glyph, col - 1, row);
+    bool right = digitGlyphPixel(glyph, col + 1, row);
+    bool top = digitGlyphPixel(glyph, col, row - 1);
+    bool bottom = digitGlyphPixel(glyph, col, row + 1);
+
+    if (left && top && !digitGlyphPixel(glyph, col - 1, row - 1) && u + v < 1.0f) return true;
+    if (right && top && !digitGlyphPixel(glyph, col + 1, row - 1) && u > v) return true;
+    if (left && bottom && !digitGlyphPixel(glyph, col - 1, row + 1) && u < v) return true;
+    if (right && bottom && !digitGlyphPixel(glyph, col + 1, row + 1) && u + v > 1.0f) return true;
+    return false;
+}
+
+/**
+ * Size of a rasterized glyph (bitmap columns, full cell height)
+ */
+inline uint32_t digitGlyphBytes(const DigitGlyph& glyph, uint8_t size) {
+    return (uint32_t)glyph.width * size * DIGIT_CELL_ROWS * size;
+}
+
+/**
+ * Rasterize a glyph at a text size
+ * @param glyph Glyph to draw
+ * @param size Text size (glyph is width * size by DIGIT_CELL_ROWS * size pixels)
+ * @param coverage Output, row-major, 0 (background) .. DIGIT_COVERAGE_MAX (ink)
+ */
+inline void rasterizeDigitGlyph(const DigitGlyph& glyph, uint8_t size, uint8_t* coverage) {
+    const int w = glyph.width * size;
+    const int h = DIGIT_CELL_ROWS * size;
+    const float step = 1.0f / (DIGIT_SUPERSAMPLE * size);
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint8_t inked = 0;
+            for (int sy = 0; sy < DIGIT_SUPERSAMPLE; sy++) {
+                float by = (y * DIGIT_SUPERSAMPLE + sy + 0.5f) * step;
+                for (int sx = 0; sx < DIGIT_SUPERSAMPLE; sx++) {
+                    float bx = (x * DIGIT_SUPERSAMPLE + sx + 0.5f) * step;
+                    if (digitGlyphInside(glyph, bx, by)) inked++;
+                }
+            }
+            coverage[y * w + x] = inked;
+        }
+    }
+}
+
+#endif // DIGIT_GLYPHS_H
@@ -0,0 +1,97 @@
+/**
+ * Dirty Rectangle Helpers
+ *
+ * Small rectangle math for partial screen updates:
+ * - Union of old and new content extents (area that must be rewritten)
+ * - Clipping to a cell
+ * - Dirty region of a centered text cell (shared by the renderer and host benchmarks)
+ *
+ * No TFT dependencies (pure integer math)
+ */
+
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <stdint.h>
+
+struct DirtyRect {
+    int16_t x;      // Left edge
+    int16_t y;      // Top edge
+    int16_t w;      // Width (<= 0 = empty)
+    int16_t h;      // Height (<= 0 = empty)
+};
+
+/**
+ * Empty rectangle (nothing to redraw)
+ */
+inline DirtyRect dirtyRectNone() {
+    DirtyRect r = {0, 0, 0, 0};
+    return r;
+}
+
+/**
+ * Check if rectangle covers no pixels
+ */
+inline bool dirtyRectEmpty(const DirtyRect& r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+/**
+ * Smallest rectangle containing both a and b (empty inputs are ignored)
+ */
+inline DirtyRect dirtyRectUnion(const DirtyRect& a, const DirtyRect& b) {
+    if (dirtyRectEmpty(a)) return b;
+    if (dirtyRectEmpty(b)) return a;
+
+    int16_t x0 = a.x < b.x ? a.x : b.x;
+    int16_t y0 = a.y < b.y ? a.y : b.y;
+    int16_t x1 = (a.x + a.w) > (b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    int16_t y1 = (a.y + a.h) > (b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+
+    DirtyRect r = {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+    return r;
+}
+
+/**
+ * Clip rectangle to bounds (result may be empty)
+ */
+inline DirtyRect dirtyRectClip(const DirtyRect& r, const DirtyRect& bounds) {
+    int16_t x0 = r.x > bounds.x ? r.x : bounds.x;
+    int16_t y0 = r.y > bounds.y ? r.y : bounds.y;
+    int16_t x1 = (r.x + r.w) < (bounds.x + bounds.w) ? (r.x + r.w) : (bounds.x + bounds.w);
+    int16_t y1 = (r.y + r.h) < (bounds.y + bounds.h) ? (r.y + r.h) : (bounds.y + bounds.h);
+
+    if (x1 <= x0 || y1 <= y0) return dirtyRectNone();
+
+    DirtyRect c = {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+    return c;
+}
+
+/**
+ * Region to rewrite when the text of a horizontally centered cell changes
+ * @param cell_w Cell width
+ * @param cell_h Cell height
+ * @param text_w Width of the new text
+ * @param text_h Height of the new text
+ * @param last_extent In: text extent drawn last time (cell coordinates, empty after a clear)
+ *                    Out: extent of the new text
+ * @param text_x Out: left edge of the new text (cell coordinates)
+ * @return Old and new text extent combined, clipped to the cell (may be empty)
+ */
+inline DirtyRect dirtyRectTextCell(int16_t cell_w, int16_t cell_h, int16_t text_w, int16_t text_h,
+                                   DirtyRect& last_extent, int16_t& text_x) {
+    const DirtyRect cell = {0, 0, cell_w, cell_h};
+
+    text_x = (cell_w - text_w) / 2;
+    if (text_x < 0) text_x = 0;
+
+    DirtyRect text_rect = {text_x, 0, text_w, text_h};
+    DirtyRect extent = dirtyRectClip(text_rect, cell);
+
+    // Rewrite old and new text area in one go
+    DirtyRect dirty = dirtyRectClip(dirtyRectUnion(last_extent, extent), cell);
+    last_extent = extent;
+    return dirty;
+}
+
+#endif // DIRTY_RECT_H
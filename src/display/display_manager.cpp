@@ -3,29 +3,84 @@
  */
 
 #include "display_manager.h"
+#include "display_writer.h"
 #include "obd2/obd_data.h"
 #include "nav_bar.h"
+#include "chrome_cache.h"
 #include "dashboard.h"
 #include "dtc_page.h"
 #include "config_page.h"
+#include "stats_page.h"
+#include "graph_page.h"
+#include "startup_screen.h"
 #include "button_nav.h"
+#include "../metrics/metrics.h"
 
 // ============================================================================
-// DISPLAY FUNCTIONS
+// RENDER QUEUE
 // ============================================================================
 
+enum RenderCommandType : uint8_t {
+    RENDER_PAGE_REDRAW = 0,     // Full redraw of a page
+    RENDER_HIGHLIGHT_MOVE,      // Move button highlight
+    RENDER_DTC_SCROLL           // Move the DTC list to the current scroll offset
+};
+
+struct RenderCommand {
+    RenderCommandType type;
+    Page page;
+    int8_t from_button;
+    int8_t to_button;
+};
+
+static QueueHandle_t render_queue = NULL;
+
+// Render commands wake the task through DISPLAY_EVT_RENDER (obd_events bit map in obd_data.h)
+
 /**
- * Safe fillScreen that avoids power spikes
- * Uses horizontal strips instead of full screen fill
+ * Post command without blocking the caller
+ * If the queue is full, fall back to a full redraw (drops stale highlight moves)
  */
-void safeFillScreen(uint16_t color) {
-    const int strip_height = 10;  // Draw in 10px strips
-    for (int y = 0; y < SCREEN_HEIGHT; y += strip_height) {
-        tft.fillRect(0, y, SCREEN_WIDTH, strip_height, color);
-        delay(5);  // Required delay after fillRect
+static void submitRenderCommand(const RenderCommand& cmd) {
+    if (render_queue == NULL) return;
+
+    if (xQueueSend(render_queue, &cmd, 0) != pdTRUE) {
+        RenderCommand redraw = {RENDER_PAGE_REDRAW, cmd.page, -1, -1};
+        xQueueReset(render_queue);
+        xQueueSend(render_queue, &redraw, 0);
     }
+    xEventGroupSetBits(obd_events, DISPLAY_EVT_RENDER);
+}
+
+void requestPageRedraw(Page page) {
+    RenderCommand cmd = {RENDER_PAGE_REDRAW, page, -1, -1};
+    submitRenderCommand(cmd);
+}
+
+void requestHighlightMove(int from_button, int to_button, Page page) {
+    RenderCommand cmd = {RENDER_HIGHLIGHT_MOVE, page, (int8_t)from_button, (int8_t)to_button};
+    submitRenderCommand(cmd);
+}
+
+void requestDTCScroll() {
+    RenderCommand cmd = {RENDER_DTC_SCROLL, PAGE_DTC, -1, -1};
+    submitRenderCommand(cmd);
 }
 
+// ============================================================================
+// DISPLAY FUNCTIONS
+// ============================================================================
+
+// Last frame showed an animated screen (connecting dots, stats counters)
+static bool screen_animated = false;
+
+// Dashboard shows the sport layout (only the sport PIDs wake the display)
+static bool sport_layout_shown = false;
+
+// A dashboard value is held back by its update rate - frame due at this time
+static bool dashboard_pending = false;
+static unsigned long dashboard_due_at = 0;
+
 void initDisplay() {
     Serial.println("Initializing display...");
     Serial.printf("TFT object address: %p\n", &tft);
@@ -39,26 +94,37 @@ void initDisplay() {
     Serial.printf("✓ Rotation set to %d\n", SCREEN_ROTATION);
 
     Serial.println("Clearing screen to BLACK...");
-    safeFillScreen(COLOR_BLACK);  // Use safe fill (already has delays)
+    displayFillScreen(COLOR_BLACK);  // Paced fill (pixel budget)
     Serial.printf("✓ Screen cleared (COLOR_BLACK = 0x%04X)\n", COLOR_BLACK);
 
+    displayInitDMA();
+
     Serial.println("✓ Display initialized");
 }
 
+const VehicleInfo& getVehicleInfo() {
+    static VehicleInfo info_copy;
+    static uint32_t info_version = 0;
+
+    // Cold block changes rarely - copy only when the OBD2 task published a new version
+    vehicle_info.readIfChanged(info_copy, info_version);
+    return info_copy;
+}
+
 void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
     static int draw_count = 0;
-    static uint16_t last_rpm = 0xFFFF;
-    static uint8_t last_speed = 0xFF;
-    static float last_coolant = -999;
-    static float last_throttle = -999;
-    static float last_battery = -999;
-    static float last_intake = -999;
+    static bool dashboard_cleared = true;  // Screen was redrawn - dashboard values must be drawn again
     static bool last_connected = false;
-    static uint8_t last_dtc_count = 0;  // Initialize to 0 (matches obd_data initial state)
+    static uint8_t last_dtc_count = 0;  // Initialize to 0 (matches vehicle_info initial state)
     static bool needs_full_redraw = true;
     static bool disconnection_screen_drawn = false;
     static uint8_t animation_state = 0;
     static bool has_been_connected = false;  // Track if we've ever been connected
+    static uint8_t dashboard_layout = 0;  // Layout shown (changes only with a full redraw)
+    static uint8_t graph_signal = 0;      // Graph signal shown (changes only with a full redraw)
+    static uint8_t stats_view = 0;        // Stats view shown (changes only with a full redraw)
+    static int dtc_detail = -1;           // DTC detail shown, -1 = list (changes only with a full redraw)
+    bool highlight_stale = false;         // Partial update repainted a button
 
     draw_count++;
 
@@ -68,14 +134,10 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
                       draw_count, current_page, page_needs_redraw);
     }
 
-    // Get data copy (thread-safe)
-    OBDData data_copy;
-    xSemaphoreTake(data_mutex, portMAX_DELAY);
-    data_copy = obd_data;
-    xSemaphoreGive(data_mutex);
-
-    // Update button visibility based on current state
-    updateButtonVisibility(current_page, data_copy.dtc_count, getDTCScrollOffset());
+    // Get data snapshots (lock-free)
+    LiveData data_copy;
+    metricsTimedRead(live_data, data_copy);
+    const VehicleInfo& info = getVehicleInfo();
 
     // Detect connection state changes
     bool connection_state_changed = (data_copy.connected != last_connected);
@@ -85,22 +147,40 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
     // DTC count change should only trigger full redraw on DTC page (to update the list)
     // On other pages, just the top bar status indicator needs updating (handled by partial redraw)
     bool dtc_changed_on_dtc_page = (current_page == PAGE_DTC &&
-                                     data_copy.dtc_count != last_dtc_count);
+                                     info.dtc_count != last_dtc_count);
+
+    // Handle initial connection (first time connecting after startup)
+    bool is_initial_connection = (connection_state_changed &&
+                                  data_copy.connected &&
+                                  !has_been_connected);
 
     // Check if full redraw is needed
-    // Full redraw on: page change, disconnection, reconnection, or DTC change while viewing DTC page
+    // Full redraw on: page change, (re)connection, disconnection, or DTC change while viewing DTC page
+    // Cheap with the chrome cache - the static background is one blit
     bool do_full_redraw = (page_needs_redraw ||
                            is_disconnecting ||
                            is_reconnecting ||
+                           is_initial_connection ||
                            dtc_changed_on_dtc_page ||
                            needs_full_redraw);
 
+    // Dashboard layout, graph signal and stats view selection are picked up with the next full redraw
+    if (do_full_redraw) {
+        sport_layout_shown = obd_requests.sport_mode.load();
+        dashboard_layout = sport_layout_shown ? DASHBOARD_SPORT_LAYOUT : getActiveDashboardLayout();
+        graph_signal = getGraphSignal();
+        stats_view = getStatsView();
+        dtc_detail = getDTCDetailIndex(info.dtc_count);
+    }
+
     // Determine page name
     const char* page_name;
     switch (current_page) {
-        case PAGE_DASHBOARD: page_name = "Dashboard"; break;
-        case PAGE_DTC:       page_name = "DTC Codes"; break;
+        case PAGE_DASHBOARD: page_name = getDashboardLayout(dashboard_layout).name; break;
+        case PAGE_DTC:       page_name = dtc_detail >= 0 ? "DTC Detail" : "DTC Codes"; break;
         case PAGE_CONFIG:    page_name = "Config"; break;
+        case PAGE_STATS:     page_name = statsViewName(stats_view); break;
+        case PAGE_GRAPH:     page_name = getGraphSignalInfo(graph_signal).title; break;
         default:             page_name = "Unknown"; break;
     }
 
@@ -108,10 +188,10 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
     uint16_t status_color = STATUS_OK;
     if (!data_copy.connected) {
         status_color = STATUS_ERROR;
-    } else if (data_copy.dtc_count > 0) {
+    } else if (info.dtc_count > 0) {
         bool has_critical = false;
-        for (int i = 0; i < data_copy.dtc_count; i++) {
-            if (data_copy.dtc_codes[i].severity == DTC_SEVERITY_CRITICAL) {
+        for (int i = 0; i < info.dtc_count; i++) {
+            if (info.dtc_codes[i].severity == DTC_SEVERITY_CRITICAL) {
                 has_critical = true;
                 break;
             }
@@ -119,96 +199,40 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
         status_color = has_critical ? STATUS_ERROR : STATUS_WARNING;
     }
 
-    // Handle initial connection (first time connecting after startup)
-    bool is_initial_connection = (connection_state_changed &&
-                                   data_copy.connected &&
-                                   !has_been_connected);
-
-    // Full redraw if page changed or connection state changed
+    // Full redraw: static background from the chrome cache (or drawn directly without PSRAM)
     if (do_full_redraw) {
         Serial.println("[Display] Starting full redraw...");
 
-        // Explicitly clear ALL nav button highlights before full redraw
-        // This ensures old highlights don't persist through page changes
-        // We clear all three nav buttons with black to completely remove any highlights
-        Serial.println("[Display] Clearing all button highlights...");
-        for (int i = 0; i < 3; i++) {  // Clear all 3 nav buttons
-            // Clear with BLACK to completely remove highlight, regardless of page state
-            for (int j = 0; j < 2; j++) {
-                int btn_x = i * 160;  // NAV_BUTTON_WIDTH = 160
-                int btn_y = 280;      // BOTTOM_NAV_Y
-                int x = btn_x + j + 1;
-                int y = btn_y + j + 1;
-                int w = 160 - ((j + 1) * 2);
-                int h = 40 - ((j + 1) * 2);
-                if (w > 4 && h > 4) {
-                    tft.drawRect(x, y, w, h, COLOR_BLACK);
-                }
-            }
-        }
-
-        // Clear screen first (use safe fill to avoid power spike)
-        Serial.println("[Display] Clearing screen...");
-        safeFillScreen(COLOR_BLACK);
-        Serial.println("[Display] Screen cleared");
-
-        // Draw top bar
-        Serial.println("[Display] Drawing top bar...");
-        drawTopBar("OBDeck", page_name, status_color, data_copy.dtc_count);
-        Serial.println("[Display] Top bar drawn");
-
-        // Draw bottom navigation
-        Serial.println("[Display] Drawing bottom nav...");
-        drawBottomNav(current_page);
-        Serial.println("[Display] Bottom nav drawn");
-
-
-        // Reset DTC scroll when switching to DTC page
-        if (current_page == PAGE_DTC) {
-            resetDTCScroll();
-        }
+        // Chrome replaces every pixel - old button highlights go with it
+        PageChrome chrome;
+        chrome.page = current_page;
+        chrome.page_name = page_name;
+        chrome.status_color = status_color;
+        chrome.dtc_count = info.dtc_count;
+        chrome.with_content = data_copy.connected;  // Connecting screen draws its own box
+        chrome.layout_index = dashboard_layout;
+        chrome.graph_signal = graph_signal;
+        chrome.info_tag = (current_page == PAGE_CONFIG) ? chromeInfoTag(info) : 0;
+        chrome.sport_mode = obd_requests.sport_mode.load();
+        chrome.info = &info;
+        showPageChrome(chrome);
+        Serial.println("[Display] Page chrome drawn");
 
         // Reset flags
         page_needs_redraw = false;
         last_connected = data_copy.connected;
-        last_dtc_count = data_copy.dtc_count;
+        last_dtc_count = info.dtc_count;
         needs_full_redraw = false;
 
         // Force redraw of all values
-        last_rpm = 0xFFFF;
-        last_speed = 0xFF;
-        last_coolant = -999;
-        last_throttle = -999;
-        last_battery = -999;
-        last_intake = -999;
-
-        // Content area already cleared by safeFillScreen above - no need to clear again
-        Serial.println("[Display] Ready to draw page content...");
-    }
-    // Handle initial connection without full redraw (just clear error screen area)
-    else if (is_initial_connection) {
-        Serial.println("[Display] Initial connection - clearing error screen...");
-
-        // Clear only the content area (not the entire screen)
-        const int strip_height = 10;
-        for (int y = CONTENT_Y_START; y < SCREEN_HEIGHT - BOTTOM_NAV_HEIGHT; y += strip_height) {
-            int height = min(strip_height, SCREEN_HEIGHT - BOTTOM_NAV_HEIGHT - y);
-            tft.fillRect(0, y, SCREEN_WIDTH, height, COLOR_BLACK);
-            delay(10);  // Required after fillRect
-        }
-
-        // Update top bar only (status color may have changed)
-        drawTopBar("OBDeck", page_name, status_color, data_copy.dtc_count);
+        dashboard_cleared = true;
 
-        // Mark for connected
-        last_connected = data_copy.connected;
-
-        Serial.println("[Display] Error screen cleared, ready for dashboard...");
+        Serial.println("[Display] Ready to draw page content...");
     }
     // Update top bar if DTC count or status changed (but not full redraw)
-    else if (data_copy.dtc_count != last_dtc_count || connection_state_changed) {
-        drawTopBar("OBDeck", page_name, status_color, data_copy.dtc_count);
-        last_dtc_count = data_copy.dtc_count;
+    else if (info.dtc_count != last_dtc_count || connection_state_changed) {
+        drawTopBar("OBDeck", page_name, status_color, info.dtc_count);
+        last_dtc_count = info.dtc_count;
     }
 
     // Track that we've been connected
@@ -216,6 +240,10 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
         has_been_connected = true;
     }
 
+    // Only animated screens need frames without a change notification
+    screen_animated = !data_copy.connected || current_page == PAGE_STATS;
+    dashboard_pending = false;
+
     if (!data_copy.connected) {
         // Show connection error
         int center_y = CONTENT_Y_START + (CONTENT_HEIGHT / 2) - 60;
@@ -224,12 +252,8 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
         if (!disconnection_screen_drawn || do_full_redraw) {
             // Content area already cleared above - just draw the error box
 
-            // Red box background - USE STRIPS to avoid power spike!
-            const int strip_height = 10;
-            for (int y_offset = 0; y_offset < 120; y_offset += strip_height) {
-                tft.fillRect(50, center_y + y_offset, SCREEN_WIDTH - 100, strip_height, COLOR_DARKGRAY);
-                delay(10);  // Required delay after fillRect
-            }
+            // Box background (paced fill, split into strips by display writer)
+            displayFillRect(50, center_y, SCREEN_WIDTH - 100, 120, COLOR_DARKGRAY);
 
             // Draw borders
             tft.drawRect(50, center_y, SCREEN_WIDTH - 100, 120, COLOR_WHITE);
@@ -272,8 +296,8 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
         tft.setTextSize(2);
         tft.setTextDatum(TL_DATUM);
         tft.setTextPadding(100);  // Clear old dots automatically
+        displayReservePixels(100 * 16);  // Padding fills 100 px x 16 rows internally
         tft.drawString(dots, 220, center_y + 80);
-        delay(20);  // Required delay after drawString with padding (uses fillRect internally)
 
         // Reset text settings after animation
         tft.setTextPadding(0);
@@ -285,44 +309,187 @@ void drawCurrentPage(Page current_page, bool& page_needs_redraw) {
 
         // Draw page content based on current page
         if (current_page == PAGE_DASHBOARD) {
-            Serial.println("[Display] >>> STEP 5: Drawing dashboard page...");
-            bool is_full_redraw = (last_rpm == 0xFFFF);
-            drawDashboardPage(
-                data_copy.rpm, last_rpm,
-                data_copy.speed, last_speed,
-                data_copy.coolant_temp, last_coolant,
-                data_copy.throttle, last_throttle,
-                data_copy.battery_voltage, last_battery,
-                data_copy.intake_temp, last_intake,
-                is_full_redraw
-            );
-
-            Serial.println("[Display] Dashboard page drawn OK");
-
-            last_rpm = data_copy.rpm;
-            last_speed = data_copy.speed;
-            last_coolant = data_copy.coolant_temp;
-            last_throttle = data_copy.throttle;
-            last_battery = data_copy.battery_voltage;
-            last_intake = data_copy.intake_temp;
+            uint32_t due_in = drawDashboardPage(data_copy, dashboard_layout, dashboard_cleared);
+            dashboard_cleared = false;
+            dashboard_pending = (due_in > 0);
+            dashboard_due_at = millis() + due_in;
         } else if (current_page == PAGE_DTC) {
             if (do_full_redraw) {
                 // Already cleared above, just draw page
-                drawDTCPage(data_copy.dtc_codes, data_copy.dtc_count);
+                if (dtc_detail >= 0) {
+                    drawDTCDetail(info, dtc_detail);
+                } else {
+                    drawDTCPage(info.dtc_codes, info.dtc_count);
+                }
+            } else if (dtc_detail < 0 && getDTCScrollOffset() != getDTCListOffset()) {
+                // Scrolled: rows entering the list only, chrome and header buttons stay
+                highlight_stale = scrollDTCList(info.dtc_codes, info.dtc_count);
             }
         } else if (current_page == PAGE_CONFIG) {
-            // Config page is static - only draw on page change
-            if (do_full_redraw) {
-                // Already cleared above, just draw page
-                drawConfigPage();
+            // Config page is static - drawn with the page chrome
+        } else if (current_page == PAGE_GRAPH) {
+            // New sample columns only (whole history after a full redraw)
+            drawGraphPage(graph_signal, do_full_redraw);
+        } else if (current_page == PAGE_STATS) {
+            // Counters change constantly - rewrite the fixed-width lines periodically
+            static unsigned long last_stats_draw = 0;
+            if (do_full_redraw || millis() - last_stats_draw >= STATS_PAGE_REFRESH_MS) {
+                drawStatsPage(stats_view);
+                last_stats_draw = millis();
             }
         }
     }
 
-    // Redraw button highlight (only on full redraw to avoid text buffer issues)
-    if (do_full_redraw) {
+    // Finish background pushes before the next direct draw
+    displayFlush();
+
+    // Redraw button highlight (only on full redraw or a repainted button to avoid text buffer issues)
+    if (do_full_redraw || highlight_stale) {
         Serial.printf("[Display] Refreshing button highlight: button_index=%d, page=%d\n",
                       current_button_index, current_page);
         refreshButtonHighlight(current_page);
     }
 }
+
+// ============================================================================
+// DISPLAY TASK (Core 1)
+// ============================================================================
+
+/**
+ * Apply one render command
+ * Highlight moves are drawn immediately unless a full redraw is pending
+ */
+static void applyRenderCommand(const RenderCommand& cmd, Page& render_page, bool& needs_redraw,
+                               bool& content_due) {
+    switch (cmd.type) {
+        case RENDER_PAGE_REDRAW:
+            render_page = cmd.page;
+            needs_redraw = true;
+            break;
+
+        case RENDER_HIGHLIGHT_MOVE:
+            // Full redraw refreshes the highlight anyway
+            if (needs_redraw || cmd.page != render_page) break;
+            drawButtonHighlight(cmd.from_button, false, render_page);
+            drawButtonHighlight(cmd.to_button, true, render_page);
+            break;
+
+        case RENDER_DTC_SCROLL:
+            // Drawn with the next frame (the page compares the offset it shows)
+            content_due = true;
+            break;
+    }
+}
+
+/**
+ * Change bits that affect what a page shows
+ * Pages outside the dashboard ignore live PID updates entirely,
+ * the graph page draws on every new sample (even if the value is unchanged),
+ * the sport layout only on the PIDs it shows
+ */
+static EventBits_t pageEventMask(Page page) {
+    if (page == PAGE_DASHBOARD && sport_layout_shown) {
+        return OBD_EVT_RPM | OBD_EVT_SPEED | OBD_EVT_THROTTLE |
+               OBD_EVT_CONNECTION | OBD_EVT_VEHICLE_INFO;
+    }
+    if (page == PAGE_DASHBOARD) {
+        return OBD_EVT_ALL;
+    }
+    if (page == PAGE_GRAPH) {
+        return OBD_EVT_SAMPLE | OBD_EVT_CONNECTION | OBD_EVT_VEHICLE_INFO;
+    }
+    return OBD_EVT_CONNECTION | OBD_EVT_VEHICLE_INFO;
+}
+
+/**
+ * Startup animation while the OBD2 task connects
+ * Wakes on connection progress or after one animation frame, returns as
+ * soon as the first values are in (the connection runs meanwhile on Core 0)
+ */
+static void runStartupScreen() {
+    StartupScreen screen;
+    LiveData data;
+    uint32_t start = millis();
+
+    beginStartupScreen(screen, start);
+    do {
+        xEventGroupWaitBits(obd_events, OBD_EVT_CONNECTION, pdTRUE, pdFALSE,
+                            pdMS_TO_TICKS(STARTUP_FRAME_MS));
+        metricsTimedRead(live_data, data);
+    } while (stepStartupScreen(screen, millis(), data));
+
+    Serial.printf("[Display Task] Startup screen done after %lu ms (stage %d)\n",
+                  (unsigned long)(millis() - start), data.link_stage);
+}
+
+/**
+ * Display task - runs the startup screen, then owns all TFT access
+ * Sleeps on obd_events until a shown value changes or a render command arrives
+ * Animated screens additionally wake every DISPLAY_REFRESH_MS
+ */
+static void displayTask(void* parameter) {
+    Serial.println("[Display Task] Starting on Core 1...");
+
+    runStartupScreen();
+
+    Page render_page = current_page;
+    bool needs_redraw = true;  // First frame clears the startup screen
+    unsigned long last_update = 0;
+
+    while (true) {
+        TickType_t wait = portMAX_DELAY;
+        if (needs_redraw) {
+            wait = 0;
+        } else if (screen_animated) {
+            unsigned long elapsed = millis() - last_update;
+            wait = elapsed >= DISPLAY_REFRESH_MS ? 0 : pdMS_TO_TICKS(DISPLAY_REFRESH_MS - elapsed);
+        } else if (dashboard_pending) {
+            long remaining = (long)(dashboard_due_at - millis());
+            wait = remaining > 0 ? pdMS_TO_TICKS(remaining) : 0;
+        }
+
+        // Sample bits only wake the graph page (left set otherwise, harmless)
+        EventBits_t wait_bits = OBD_EVT_ALL | DISPLAY_EVT_RENDER |
+                                (pageEventMask(render_page) & OBD_EVT_SAMPLE);
+        EventBits_t bits = xEventGroupWaitBits(obd_events, wait_bits, pdTRUE, pdFALSE, wait);
+
+        // Drain all pending commands (coalesces bursts of button presses)
+        RenderCommand cmd;
+        bool content_due = false;
+        while (xQueueReceive(render_queue, &cmd, 0) == pdTRUE) {
+            applyRenderCommand(cmd, render_page, needs_redraw, content_due);
+        }
+
+        bool data_changed = (bits & pageEventMask(render_page)) != 0;
+        bool tick_due = (screen_animated && millis() - last_update >= DISPLAY_REFRESH_MS) ||
+                        (dashboard_pending && (long)(dashboard_due_at - millis()) <= 0);
+
+        if (needs_redraw || data_changed || tick_due || content_due) {
+            uint32_t frame_start = micros();
+            drawCurrentPage(render_page, needs_redraw);
+
+            uint32_t fill_us, wait_us;
+            displayTakeFrameTimes(fill_us, wait_us);
+            metricsRecordFrame(micros() - frame_start, fill_us, wait_us);
+            last_update = millis();
+        }
+    }
+}
+
+void startDisplayTask() {
+    render_queue = xQueueCreate(DISPLAY_QUEUE_LENGTH, sizeof(RenderCommand));
+    if (render_queue == NULL) {
+        Serial.println("ERROR: Failed to create render queue!");
+        while (1) delay(1000);
+    }
+
+    xTaskCreatePinnedToCore(
+        displayTask,              // Task function
+        "DisplayTask",            // Task name
+        DISPLAY_TASK_STACK_SIZE,  // Stack size
+        NULL,                     // Parameters
+        DISPLAY_TASK_PRIORITY,    // Priority
+        NULL,                     // Task handle
+        DISPLAY_TASK_CORE         // Core (1)
+    );
+}
@@ -3,6 +3,8 @@
  *
  * Handles display initialization and rendering:
  * - Display hardware initialization
+ * - Display task on Core 1 that owns all TFT access
+ * - Render queue (page redraws, highlight moves, DTC scrolls) fed by the input loop
  * - Page rendering with smart partial updates
  * - Connection status display
  * - Data visualization
@@ -15,6 +17,7 @@
 #include <TFT_eSPI.h>
 #include "config.h"
 #include "ui_common.h"
+#include "obd2/obd_data.h"
 
 // ============================================================================
 // FUNCTION DECLARATIONS
@@ -26,6 +29,46 @@
  */
 void initDisplay();
 
+/**
+ * Start display task (Core 1)
+ * Draws on change notifications (obd_events) and render queue commands,
+ * sleeps otherwise (animated screens tick at DISPLAY_REFRESH_MS)
+ * The task runs the startup screen itself (stepped by connection progress) and
+ * owns the TFT from the start - call after initDisplay() and after creating the OBD2 task
+ */
+void startDisplayTask();
+
+/**
+ * Queue a full redraw of a page (page change, view change)
+ * Never blocks - safe to call from the input loop
+ * @param page Page to show
+ */
+void requestPageRedraw(Page page);
+
+/**
+ * Queue a highlight move between two buttons
+ * Never blocks - safe to call from the input loop
+ * @param from_button Button index to un-highlight (-1 for none)
+ * @param to_button Button index to highlight
+ * @param page Page the buttons belong to (ignored if a redraw is pending)
+ */
+void requestHighlightMove(int from_button, int to_button, Page page);
+
+/**
+ * Queue a DTC list scroll to the current dtc_scroll_offset
+ * Only the rows entering the list are rendered, the rest of the page stays
+ * Never blocks - safe to call from the input loop
+ */
+void requestDTCScroll();
+
+/**
+ * Get display-side copy of vehicle info (DTCs, VIN)
+ * Refreshed from the OBD2 task only when a new version was published
+ * Call from the display task only
+ * @return Latest vehicle info snapshot
+ */
+const VehicleInfo& getVehicleInfo();
+
 /**
  * Draw current page with smart partial updates
  * Handles all page rendering based on current_page state
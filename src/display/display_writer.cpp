@@ -0,0 +1,200 @@
+/**
+ * Display Writer - Implementation
+ */
+
+#include "display_writer.h"
+#include "ui_common.h"
+#include <esp_heap_caps.h>
+
+static_assert(DISPLAY_FILL_STRIP_PIXELS <= DISPLAY_PIXEL_BUDGET,
+              "A fill strip must fit into the pixel budget");
+
+// ============================================================================
+// PIXEL BUDGET (token bucket)
+// ============================================================================
+
+static uint32_t budget_pixels = DISPLAY_PIXEL_BUDGET;  // Pixels available now
+static uint32_t budget_updated_ms = 0;                 // Last refill time
+
+// Frame timing (reset by displayTakeFrameTimes)
+static uint32_t frame_fill_us = 0;
+static uint32_t frame_wait_us = 0;
+
+/**
+ * Add pixels earned since the last refill (capped at one full budget)
+ */
+static void refillBudget() {
+    uint32_t now = millis();
+    uint32_t elapsed = now - budget_updated_ms;
+    if (elapsed == 0) return;
+    budget_updated_ms = now;
+
+    if (elapsed >= DISPLAY_BUDGET_WINDOW_MS) {
+        budget_pixels = DISPLAY_PIXEL_BUDGET;
+        return;
+    }
+
+    budget_pixels += elapsed * DISPLAY_PIXEL_BUDGET / DISPLAY_BUDGET_WINDOW_MS;
+    if (budget_pixels > DISPLAY_PIXEL_BUDGET) budget_pixels = DISPLAY_PIXEL_BUDGET;
+}
+
+void displayReservePixels(uint32_t pixels) {
+    // A single write larger than the bucket waits for a full bucket
+    if (pixels > DISPLAY_PIXEL_BUDGET) pixels = DISPLAY_PIXEL_BUDGET;
+
+    refillBudget();
+    if (budget_pixels >= pixels) {
+        budget_pixels -= pixels;
+        return;
+    }
+
+    uint32_t start = micros();
+    while (budget_pixels < pixels) {
+        uint32_t missing = pixels - budget_pixels;
+        uint32_t wait_ms = (missing * DISPLAY_BUDGET_WINDOW_MS + DISPLAY_PIXEL_BUDGET - 1) /
+                           DISPLAY_PIXEL_BUDGET;
+        delay(wait_ms);
+        refillBudget();
+    }
+    budget_pixels -= pixels;
+    frame_wait_us += micros() - start;
+}
+
+// ============================================================================
+// PACED FILLS
+// ============================================================================
+
+void displayFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+
+    displayFlush();
+
+    uint32_t start = micros();
+    uint32_t wait_before = frame_wait_us;
+
+    // Rows per strip so that each strip stays within DISPLAY_FILL_STRIP_PIXELS
+    int32_t strip_rows = DISPLAY_FILL_STRIP_PIXELS / w;
+    if (strip_rows < 1) strip_rows = 1;
+
+    for (int32_t row = 0; row < h; row += strip_rows) {
+        int32_t rows = (h - row < strip_rows) ? (h - row) : strip_rows;
+        displayReservePixels((uint32_t)w * rows);
+        tft.fillRect(x, y + row, w, rows, color);
+    }
+
+    frame_fill_us += (micros() - start) - (frame_wait_us - wait_before);
+}
+
+void displayFillScreen(uint16_t color) {
+    displayFillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color);
+}
+
+void displayFillRectOn(TFT_eSPI& gfx, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (&gfx == &tft) {
+        displayFillRect(x, y, w, h, color);
+        return;
+    }
+    gfx.fillRect(x, y, w, h, color);  // Off-screen - no panel write
+}
+
+void displayPushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* pixels) {
+    if (w <= 0 || h <= 0) return;
+
+    displayFlush();
+
+    uint32_t start = micros();
+    uint32_t wait_before = frame_wait_us;
+
+    // Sprite pixels are already in panel byte order
+    bool swap_bytes = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+
+    // One window for the whole block, pixels streamed in budget-sized bursts
+    uint32_t total = (uint32_t)w * h;
+    tft.startWrite();
+    tft.setAddrWindow(x, y, w, h);
+    for (uint32_t sent = 0; sent < total; sent += DISPLAY_FILL_STRIP_PIXELS) {
+        uint32_t burst = (total - sent < DISPLAY_FILL_STRIP_PIXELS) ? (total - sent)
+                                                                     : DISPLAY_FILL_STRIP_PIXELS;
+        displayReservePixels(burst);
+        tft.pushPixels(pixels + sent, burst);
+    }
+    tft.endWrite();
+
+    tft.setSwapBytes(swap_bytes);
+    frame_fill_us += (micros() - start) - (frame_wait_us - wait_before);
+}
+
+// ============================================================================
+// DMA PIXEL PUSHES
+// ============================================================================
+
+static uint16_t* dma_buffers[2] = {NULL, NULL};  // Ping-pong staging buffers
+static uint8_t dma_next = 0;                     // Buffer used by the next push
+static bool dma_ready = false;                   // DMA initialized successfully
+static bool dma_in_transaction = false;          // SPI held open for pending pushes
+
+void displayInitDMA() {
+    if (!DISPLAY_USE_DMA) return;
+
+    for (int i = 0; i < 2; i++) {
+        dma_buffers[i] = (uint16_t*)heap_caps_malloc(DISPLAY_DMA_BUFFER_PIXELS * sizeof(uint16_t),
+                                                     MALLOC_CAP_DMA);
+        if (dma_buffers[i] == NULL) {
+            Serial.println("[Display] DMA buffer allocation failed - using blocking pushes");
+            return;
+        }
+    }
+
+    if (!tft.initDMA()) {
+        Serial.println("[Display] TFT DMA not available - using blocking pushes");
+        return;
+    }
+
+    dma_ready = true;
+    Serial.printf("✓ Display DMA enabled (2 x %d pixel buffers)\n", DISPLAY_DMA_BUFFER_PIXELS);
+}
+
+bool displayPushDMA(int32_t x, int32_t y, int32_t w, int32_t h,
+                    const uint16_t* src, int32_t src_stride) {
+    if (!dma_ready || w <= 0 || h <= 0) return false;
+    if ((uint32_t)w * h > DISPLAY_DMA_BUFFER_PIXELS) return false;
+
+    displayReservePixels((uint32_t)w * h);
+
+    // pushImageDMA waits for the transfer before this one, so the buffer
+    // used two pushes ago is free to refill now
+    uint16_t* buffer = dma_buffers[dma_next];
+    dma_next ^= 1;
+    for (int32_t row = 0; row < h; row++) {
+        memcpy(buffer + row * w, src + row * src_stride, w * sizeof(uint16_t));
+    }
+
+    if (!dma_in_transaction) {
+        tft.startWrite();
+        dma_in_transaction = true;
+    }
+    tft.pushImageDMA(x, y, w, h, buffer);
+    return true;
+}
+
+void displayFlush() {
+    if (!dma_in_transaction) return;
+
+    uint32_t start = micros();
+    tft.dmaWait();
+    tft.endWrite();
+    dma_in_transaction = false;
+    frame_wait_us += micros() - start;
+}
+
+// ============================================================================
+// FRAME TIMING
+// ============================================================================
+
+void displayTakeFrameTimes(uint32_t& fill_us, uint32_t& wait_us) {
+    fill_us = frame_fill_us;
+    wait_us = frame_wait_us;
+    frame_fill_us = 0;
+    frame_wait_us = 0;
+}
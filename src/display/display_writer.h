@@ -0,0 +1,110 @@
+/**
+ * Display Writer - Power-aware panel write pacing
+ *
+ * Central layer for pixel writes that stress the ILI9488 supply:
+ * - Token bucket of DISPLAY_PIXEL_BUDGET pixels per DISPLAY_BUDGET_WINDOW_MS
+ * - Large fills are split into strips of at most DISPLAY_FILL_STRIP_PIXELS
+ * - Waits only when the budget is exhausted (small draws never sleep)
+ *
+ * Replaces the hand-tuned delay() calls after every fillRect
+ * Budget is calibrated once in config.h
+ *
+ * Optional DMA path (DISPLAY_USE_DMA): pixel blocks are copied into
+ * ping-pong buffers and sent in the background while the next one is rendered.
+ * Only the display task may call these functions.
+ */
+
+#ifndef DISPLAY_WRITER_H
+#define DISPLAY_WRITER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Reserve budget for a panel write, waiting only if the budget is exhausted
+ * Use before writes not done through this module (sprite pushes, padded text)
+ * @param pixels Number of pixels about to be written
+ */
+void displayReservePixels(uint32_t pixels);
+
+/**
+ * Fill rectangle within the pixel budget
+ * Split into full-width horizontal strips if larger than one strip
+ * @param x Left edge
+ * @param y Top edge
+ * @param w Width
+ * @param h Height
+ * @param color Fill color (RGB565)
+ */
+void displayFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+
+/**
+ * Fill whole screen within the pixel budget
+ * @param color Fill color (RGB565)
+ */
+void displayFillScreen(uint16_t color);
+
+/**
+ * Fill rectangle on a draw target: paced on the panel, plain fill in a sprite
+ * Lets the same drawing code render to the screen or into an off-screen frame
+ * @param gfx Draw target (tft or a sprite)
+ */
+void displayFillRectOn(TFT_eSPI& gfx, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+
+/**
+ * Push a pixel block (byte-swapped RGB565, sprite format) as one address window
+ * The pixel stream is paced in DISPLAY_FILL_STRIP_PIXELS bursts within the budget
+ * @param x Screen left edge
+ * @param y Screen top edge
+ * @param w Block width
+ * @param h Block height
+ * @param pixels w * h pixels, row by row
+ */
+void displayPushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* pixels);
+
+// ============================================================================
+// DMA PIXEL PUSHES
+// ============================================================================
+
+/**
+ * Allocate DMA buffers and enable TFT_eSPI DMA (no-op if DISPLAY_USE_DMA is false)
+ * Call once after tft.init()
+ */
+void displayInitDMA();
+
+/**
+ * Start a background push of a pixel block (byte-swapped RGB565, sprite format)
+ * @param x Screen left edge
+ * @param y Screen top edge
+ * @param w Block width
+ * @param h Block height
+ * @param src First pixel of the block
+ * @param src_stride Pixels per source row (sprite width)
+ * @return false if DMA is unavailable or the block is too large (caller pushes blocking)
+ */
+bool displayPushDMA(int32_t x, int32_t y, int32_t w, int32_t h,
+                    const uint16_t* src, int32_t src_stride);
+
+/**
+ * Wait for background pushes to finish and release the SPI bus
+ * Required before any non-DMA drawing (text, lines, fills)
+ */
+void displayFlush();
+
+// ============================================================================
+// FRAME TIMING
+// ============================================================================
+
+/**
+ * Get time spent in this module since the last call, then reset
+ * @param fill_us Out: time in paced fills (excluding budget waits)
+ * @param wait_us Out: time waiting for pixel budget or DMA completion
+ */
+void displayTakeFrameTimes(uint32_t& fill_us, uint32_t& wait_us);
+
+#endif // DISPLAY_WRITER_H
@@ -1,6 +1,10 @@
 /**
  * DTC Page - Diagnostic Trouble Codes Display
  * Improved layout with action buttons
+ *
+ * DETAIL opens the detail view of the first code on screen: code, status,
+ * full description and the Mode 02 freeze frame the ECU stored for it.
+ * NEXT steps through the codes, past the last (or the DTC tab) back to the list.
  */
 
 #ifndef DTC_PAGE_H
@@ -8,11 +12,19 @@
 
 #include "ui_common.h"
 #include "../obd2/obd_data.h"
+#include "display_writer.h"
+#include "dirty_rect.h"
+#include "metric_format.h"
 
-// Scroll state
-static int dtc_scroll_offset = 0;
+// Scroll and detail state (written by input loop, read by display task - defined in obdeck.ino)
+extern int dtc_scroll_offset;
+extern int dtc_detail_index;       // Code shown in the detail view, -1 = list
 const int DTC_ITEMS_PER_PAGE = 4;  // Show 4 DTCs (more space for buttons)
 
+// Detail button (left of REFRESH; labelled NEXT in the detail view)
+#define DTC_DETAIL_BTN_X    195
+#define DTC_DETAIL_BTN_W    90
+
 /**
  * Get current DTC scroll offset
  */
@@ -20,6 +32,307 @@ inline int getDTCScrollOffset() {
     return dtc_scroll_offset;
 }
 
+/**
+ * Get code shown in the detail view
+ * @param dtc_count Current DTC count (a shorter list closes the view)
+ * @return Index into the DTC list, -1 = list view
+ */
+inline int getDTCDetailIndex(int dtc_count) {
+    int index = dtc_detail_index;
+    return index < dtc_count ? index : -1;
+}
+
+/**
+ * Severity color and badge text of a code
+ */
+inline void getDTCSeverityStyle(uint8_t severity, uint16_t& color, const char*& badge) {
+    switch (severity) {
+        case DTC_SEVERITY_CRITICAL:
+            color = COLOR_RED;
+            badge = "CRIT";
+            break;
+        case DTC_SEVERITY_WARNING:
+            color = COLOR_YELLOW;
+            badge = "WARN";
+            break;
+        default:
+            color = COLOR_CYAN;
+            badge = "INFO";
+            break;
+    }
+}
+
+/**
+ * Draw a blue action button of the DTC header row
+ */
+inline void drawDTCHeaderButton(int x, int y, int w, const char* label) {
+    displayFillRect(x, y, w, 26, COLOR_BLUE);
+    tft.drawRect(x, y, w, 26, COLOR_WHITE);
+    tft.setTextColor(COLOR_WHITE, COLOR_BLUE);
+    tft.setTextSize(2);
+    tft.setCursor(x + (w - (int)strlen(label) * 12) / 2, y + 5);
+    tft.print(label);
+}
+
+// ============================================================================
+// LIST ROWS
+// ============================================================================
+
+// List geometry (rows scroll one at a time, the separators stay on screen)
+#define DTC_LIST_Y           (CONTENT_Y_START + 35)  // First row, below the header separator
+#define DTC_ROW_HEIGHT       40                      // Row pitch
+#define DTC_ROW_TEXT_W       340                     // Screen x 0..339 (54 description chars from x 10)
+#define DTC_ROW_TEXT_H       30                      // Code line (16 px) + description line (8 px at y 22)
+#define DTC_ROW_CACHE_SLOTS  (DTC_ITEMS_PER_PAGE + 2)
+#define DTC_DESCRIPTION_CHARS 54                     // List truncates, the detail view shows more
+
+// Scroll buttons (bottom, above the nav bar)
+#define DTC_SCROLL_BTN_Y     (BOTTOM_NAV_Y - 48)
+
+/**
+ * Text extents of one row (row coordinates: screen x, y from the row top)
+ */
+struct DTCRowExtent {
+    DirtyRect code_line;     // Code, badge and status
+    DirtyRect description;
+};
+
+/**
+ * What the list shows on screen (display task only)
+ * Set by the full redraw, advanced by scrollDTCList()
+ */
+struct DTCListView {
+    int offset;                                  // First code on screen
+    int rows;                                    // Rows drawn (<= DTC_ITEMS_PER_PAGE)
+    DTCRowExtent shown[DTC_ITEMS_PER_PAGE];      // Text extent per screen row
+    bool up_enabled;                             // Scroll button states drawn
+    bool down_enabled;
+};
+
+inline DTCListView& getDTCListView() {
+    static DTCListView view = {};
+    return view;
+}
+
+/**
+ * Rendered rows in PSRAM, keyed by DTC index
+ * Holds the rows on screen plus one row either side (virtualized: a long
+ * list never has more than DTC_ROW_CACHE_SLOTS bitmaps)
+ */
+struct DTCRowCache {
+    TFT_eSprite* sprite[DTC_ROW_CACHE_SLOTS];    // NULL = not allocated yet
+    int16_t dtc_index[DTC_ROW_CACHE_SLOTS];
+    bool valid[DTC_ROW_CACHE_SLOTS];
+    DTCRowExtent extent[DTC_ROW_CACHE_SLOTS];
+    bool disabled;                               // No PSRAM or allocation failed - draw directly
+};
+
+inline DTCRowCache& getDTCRowCache() {
+    static DTCRowCache cache = {};
+    return cache;
+}
+
+/**
+ * Drop all cached rows (the list may have changed - call on full redraw)
+ */
+inline void invalidateDTCRowCache() {
+    DTCRowCache& cache = getDTCRowCache();
+    for (int i = 0; i < DTC_ROW_CACHE_SLOTS; i++) {
+        cache.valid[i] = false;
+    }
+}
+
+/**
+ * Status words of a code (which modes reported it)
+ */
+inline int formatDTCStatus(char* out, size_t size, uint8_t status) {
+    return snprintf(out, size, "%s%s%s",
+                    (status & DTC_STATUS_STORED) ? "STORED " : "",
+                    (status & DTC_STATUS_PENDING) ? "PENDING " : "",
+                    (status & DTC_STATUS_PERMANENT) ? "PERMANENT" : "");
+}
+
+/**
+ * Text extents of a row, from the GLCD glyph metrics (6x8 per size step)
+ */
+inline DTCRowExtent measureDTCRow(const DTC& dtc) {
+    uint16_t severity_color;
+    const char* severity_badge;
+    getDTCSeverityStyle(dtc.severity, severity_color, severity_badge);
+
+    char status[32];
+    int status_len = formatDTCStatus(status, sizeof(status), dtc.status);
+    int code_right = 10 + (int)strlen(dtc.code) * 12;
+    int badge_right = 85 + ((int)strlen(severity_badge) + 2) * 6;
+    int status_right = 125 + status_len * 6;
+    int right = max(code_right, max(badge_right, status_right));
+
+    int description_len = min((int)strlen(dtc.description), DTC_DESCRIPTION_CHARS);
+
+    DTCRowExtent extent;
+    extent.code_line = {10, 0, (int16_t)(right - 10), 16};
+    extent.description = {10, 22, (int16_t)(description_len * 6), (int16_t)(description_len > 0 ? 8 : 0)};
+    return extent;
+}
+
+/**
+ * Draw the text of one row (on the screen or into a row bitmap)
+ * @param gfx Target (tft or a sprite - same drawing API)
+ * @param dtc Code to draw
+ * @param y Row top on the target
+ */
+inline void drawDTCRowText(TFT_eSPI& gfx, const DTC& dtc, int y) {
+    // Determine color based on severity
+    uint16_t severity_color;
+    const char* severity_badge;
+    getDTCSeverityStyle(dtc.severity, severity_color, severity_badge);
+
+    // DTC code and severity badge
+    gfx.setTextColor(severity_color, COLOR_BLACK);
+    gfx.setTextSize(2);
+    gfx.setCursor(10, y);
+    gfx.print(dtc.code);
+
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.setTextSize(1);
+    gfx.setCursor(85, y + 5);
+    gfx.printf("[%s]", severity_badge);
+
+    // Which modes reported the code (stored/pending/permanent)
+    char status[32];
+    formatDTCStatus(status, sizeof(status), dtc.status);
+    gfx.setTextColor(COLOR_GRAY, COLOR_BLACK);
+    gfx.setCursor(125, y + 5);
+    gfx.print(status);
+
+    // Description (truncated to the row)
+    char desc_truncated[DTC_DESCRIPTION_CHARS + 1];
+    strncpy(desc_truncated, dtc.description, DTC_DESCRIPTION_CHARS);
+    desc_truncated[DTC_DESCRIPTION_CHARS] = '\0';
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.setCursor(10, y + 22);
+    gfx.print(desc_truncated);
+}
+
+/**
+ * Get the bitmap of a row, rendering it if it is not cached
+ * Evicts the cached row farthest from the view
+ * @param dtc_data DTC list
+ * @param index Code to get
+ * @param offset First code of the view being drawn (never evicted)
+ * @return Cache slot, -1 if bitmaps are unavailable (caller draws directly)
+ */
+inline int getDTCRowBitmap(const DTC* dtc_data, int index, int offset) {
+    DTCRowCache& cache = getDTCRowCache();
+    if (cache.disabled) return -1;
+
+    int slot = -1;
+    int farthest = -1;
+    for (int i = 0; i < DTC_ROW_CACHE_SLOTS; i++) {
+        if (cache.valid[i] && cache.dtc_index[i] == index) return i;
+
+        // Free slot first, else the row farthest outside the view
+        int distance = DTC_ROW_CACHE_SLOTS * 2;
+        if (cache.valid[i]) {
+            int row = cache.dtc_index[i];
+            if (row < offset) distance = offset - row;
+            else if (row >= offset + DTC_ITEMS_PER_PAGE) distance = row - (offset + DTC_ITEMS_PER_PAGE) + 1;
+            else distance = 0;  // On screen this step
+        }
+        if (distance > farthest) {
+            farthest = distance;
+            slot = i;
+        }
+    }
+    if (slot < 0 || farthest == 0) return -1;
+
+    if (cache.sprite[slot] == NULL) {
+        // 20 KB per row - PSRAM or nothing
+        if (!psramFound()) {
+            Serial.println("[Display] No PSRAM - DTC rows drawn directly");
+            cache.disabled = true;
+            return -1;
+        }
+        TFT_eSprite* sprite = new TFT_eSprite(&tft);
+        sprite->setColorDepth(16);
+        if (sprite->createSprite(DTC_ROW_TEXT_W, DTC_ROW_TEXT_H) == NULL) {
+            Serial.println("[Display] DTC row bitmap allocation failed - drawing rows directly");
+            delete sprite;
+            cache.disabled = true;
+            return -1;
+        }
+        cache.sprite[slot] = sprite;
+    }
+
+    // Rasterize the row entering the view
+    TFT_eSprite& sprite = *cache.sprite[slot];
+    sprite.fillSprite(COLOR_BLACK);
+    drawDTCRowText(sprite, dtc_data[index], 0);
+    cache.extent[slot] = measureDTCRow(dtc_data[index]);
+    cache.dtc_index[slot] = (int16_t)index;
+    cache.valid[slot] = true;
+    return slot;
+}
+
+/**
+ * Push one rectangle of a row bitmap to the screen
+ * @param sprite Row bitmap
+ * @param area Rectangle (row coordinates)
+ * @param row_y Row top on screen
+ */
+inline void pushDTCRowArea(TFT_eSprite& sprite, const DirtyRect& area, int row_y) {
+    const DirtyRect bounds = {0, 0, DTC_ROW_TEXT_W, DTC_ROW_TEXT_H};
+    DirtyRect dirty = dirtyRectClip(area, bounds);
+    if (dirtyRectEmpty(dirty)) return;
+
+    // Single window write (background DMA if available)
+    uint16_t* pixels = (uint16_t*)sprite.getPointer();
+    if (displayPushDMA(dirty.x, row_y + dirty.y, dirty.w, dirty.h,
+                       pixels + dirty.y * sprite.width() + dirty.x, sprite.width())) {
+        return;
+    }
+    displayReservePixels((uint32_t)dirty.w * dirty.h);
+    sprite.pushSprite(dirty.x, row_y + dirty.y, dirty.x, dirty.y, dirty.w, dirty.h);
+}
+
+/**
+ * Count and visible range line of the list header (fixed width, opaque)
+ */
+inline void drawDTCListHeader(int dtc_count, int offset) {
+    int last = min(offset + DTC_ITEMS_PER_PAGE, dtc_count);
+
+    char header[32];
+    snprintf(header, sizeof(header), "%d DTC(s) Found | %d-%d", dtc_count, offset + 1, last);
+
+    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(10, CONTENT_Y_START + 5);
+    tft.printf("%-28s", header);  // Padding clears a longer old range (ends before DETAIL)
+}
+
+/**
+ * Draw a scroll button (blue enabled, dark gray disabled)
+ */
+inline void drawDTCScrollButton(int x, const char* label, int label_x, bool enabled) {
+    uint16_t fill = enabled ? COLOR_BLUE : COLOR_DARKGRAY;
+    uint16_t text = enabled ? COLOR_WHITE : COLOR_GRAY;
+
+    displayFillRect(x, DTC_SCROLL_BTN_Y, 140, 38, fill);
+    tft.drawRect(x, DTC_SCROLL_BTN_Y, 140, 38, enabled ? COLOR_WHITE : COLOR_GRAY);
+    tft.setTextColor(text, fill);
+    tft.setTextSize(2);
+    tft.setCursor(label_x, DTC_SCROLL_BTN_Y + 11);
+    tft.print(label);
+}
+
+inline void drawDTCUpButton(bool enabled) {
+    drawDTCScrollButton(80, "^ UP ^", 102, enabled);
+}
+
+inline void drawDTCDownButton(bool enabled) {
+    drawDTCScrollButton(260, "v DOWN v", 272, enabled);
+}
+
 /**
  * Draw DTC codes page with improved layout
  * @param dtc_data Pointer to DTC data array
@@ -27,6 +340,13 @@ inline int getDTCScrollOffset() {
  */
 inline void drawDTCPage(const DTC* dtc_data, int dtc_count) {
     int y = CONTENT_Y_START + 5;
+    int offset = dtc_scroll_offset;  // Input loop may scroll meanwhile - draw one offset
+
+    // List may have changed - rows are rendered again when scrolled in
+    DTCListView& view = getDTCListView();
+    invalidateDTCRowCache();
+    view.offset = offset;
+    view.rows = 0;
 
     if (dtc_count == 0) {
         // No codes - all clear (centered)
@@ -44,7 +364,7 @@ inline void drawDTCPage(const DTC* dtc_data, int dtc_count) {
 
         // Refresh button (same position as when DTCs exist - top right)
         int btn_y = CONTENT_Y_START + 3;
-        tft.fillRect(290, btn_y, 90, 26, COLOR_BLUE);
+        displayFillRect(290, btn_y, 90, 26, COLOR_BLUE);
         tft.drawRect(290, btn_y, 90, 26, COLOR_WHITE);
         tft.setTextColor(COLOR_WHITE, COLOR_BLUE);
         tft.setTextSize(2);
@@ -52,21 +372,17 @@ inline void drawDTCPage(const DTC* dtc_data, int dtc_count) {
         tft.print("REFRESH");
 
     } else {
-        // Compact header with count and pagination
-        tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-        tft.setTextSize(1);
-        tft.setCursor(10, y);
-
-        int total_pages = (dtc_count + DTC_ITEMS_PER_PAGE - 1) / DTC_ITEMS_PER_PAGE;
-        int current_page = (dtc_scroll_offset / DTC_ITEMS_PER_PAGE) + 1;
-
-        tft.printf("%d DTC(s) Found | Page %d/%d", dtc_count, current_page, total_pages);
+        // Compact header with count and visible range
+        drawDTCListHeader(dtc_count, offset);
 
         // Action buttons (top right) - adjusted positions to fit on screen
         int btn_y = y - 2;
 
+        // Detail button (freeze frame of the first code on screen)
+        drawDTCHeaderButton(DTC_DETAIL_BTN_X, btn_y, DTC_DETAIL_BTN_W, "DETAIL");
+
         // Refresh button (moved left to x=290, width=90)
-        tft.fillRect(290, btn_y, 90, 26, COLOR_BLUE);
+        displayFillRect(290, btn_y, 90, 26, COLOR_BLUE);
         tft.drawRect(290, btn_y, 90, 26, COLOR_WHITE);
         tft.setTextColor(COLOR_WHITE, COLOR_BLUE);
         tft.setTextSize(2);
@@ -74,7 +390,7 @@ inline void drawDTCPage(const DTC* dtc_data, int dtc_count) {
         tft.print("REFRESH");
 
         // Clear All button (moved left to x=390, width=85, red)
-        tft.fillRect(390, btn_y, 85, 26, COLOR_RED);
+        displayFillRect(390, btn_y, 85, 26, COLOR_RED);
         tft.drawRect(390, btn_y, 85, 26, COLOR_WHITE);
         tft.setTextColor(COLOR_WHITE, COLOR_RED);
         tft.setTextSize(2);
@@ -85,129 +401,275 @@ inline void drawDTCPage(const DTC* dtc_data, int dtc_count) {
 
         // Separator line
         tft.drawLine(5, y, SCREEN_WIDTH - 5, y, COLOR_GRAY);
-        y += 5;
 
         // Display DTCs (with scrolling)
-        int end_index = min(dtc_scroll_offset + DTC_ITEMS_PER_PAGE, dtc_count);
-
-        for (int i = dtc_scroll_offset; i < end_index; i++) {
-            const DTC& dtc = dtc_data[i];
-
-            // Determine color based on severity
-            uint16_t severity_color;
-            const char* severity_badge;
-            switch (dtc.severity) {
-                case DTC_SEVERITY_CRITICAL:
-                    severity_color = COLOR_RED;
-                    severity_badge = "CRIT";
-                    break;
-                case DTC_SEVERITY_WARNING:
-                    severity_color = COLOR_YELLOW;
-                    severity_badge = "WARN";
-                    break;
-                default:
-                    severity_color = COLOR_CYAN;
-                    severity_badge = "INFO";
-                    break;
-            }
-
-            // DTC code and severity badge
-            tft.setTextColor(severity_color, COLOR_BLACK);
-            tft.setTextSize(2);
-            tft.setCursor(10, y);
-            tft.print(dtc.code);
-
-            tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-            tft.setTextSize(1);
-            tft.setCursor(85, y + 5);
-            tft.printf("[%s]", severity_badge);
-
-            y += 22;
-
-            // Description
-            tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-            tft.setTextSize(1);
-            tft.setCursor(10, y);
-
-            // Truncate description if too long
-            char desc_truncated[55];
-            strncpy(desc_truncated, dtc.description, 54);
-            desc_truncated[54] = '\0';
-            tft.print(desc_truncated);
-
-            y += 13;
+        int end_index = min(offset + DTC_ITEMS_PER_PAGE, dtc_count);
+
+        for (int i = offset; i < end_index; i++) {
+            int row_y = DTC_LIST_Y + view.rows * DTC_ROW_HEIGHT;
+            drawDTCRowText(tft, dtc_data[i], row_y);
+            view.shown[view.rows++] = measureDTCRow(dtc_data[i]);
 
             // Separator
-            tft.drawLine(5, y, SCREEN_WIDTH - 5, y, COLOR_DARKGRAY);
-            y += 5;
+            tft.drawLine(5, row_y + 35, SCREEN_WIDTH - 5, row_y + 35, COLOR_DARKGRAY);
         }
 
         // Scroll buttons at bottom if needed
         if (dtc_count > DTC_ITEMS_PER_PAGE) {
-            int button_y = BOTTOM_NAV_Y - 48;
-
-            // Up button
-            if (dtc_scroll_offset > 0) {
-                tft.fillRect(80, button_y, 140, 38, COLOR_BLUE);
-                tft.drawRect(80, button_y, 140, 38, COLOR_WHITE);
-                tft.setTextColor(COLOR_WHITE, COLOR_BLUE);
-                tft.setTextSize(2);
-                tft.setCursor(102, button_y + 11);
-                tft.print("^ UP ^");
-            } else {
-                tft.fillRect(80, button_y, 140, 38, COLOR_DARKGRAY);
-                tft.drawRect(80, button_y, 140, 38, COLOR_GRAY);
-                tft.setTextColor(COLOR_GRAY, COLOR_DARKGRAY);
-                tft.setTextSize(2);
-                tft.setCursor(102, button_y + 11);
-                tft.print("^ UP ^");
-            }
-
-            // Down button
-            if (dtc_scroll_offset + DTC_ITEMS_PER_PAGE < dtc_count) {
-                tft.fillRect(260, button_y, 140, 38, COLOR_BLUE);
-                tft.drawRect(260, button_y, 140, 38, COLOR_WHITE);
-                tft.setTextColor(COLOR_WHITE, COLOR_BLUE);
-                tft.setTextSize(2);
-                tft.setCursor(272, button_y + 11);
-                tft.print("v DOWN v");
-            } else {
-                tft.fillRect(260, button_y, 140, 38, COLOR_DARKGRAY);
-                tft.drawRect(260, button_y, 140, 38, COLOR_GRAY);
-                tft.setTextColor(COLOR_GRAY, COLOR_DARKGRAY);
-                tft.setTextSize(2);
-                tft.setCursor(272, button_y + 11);
-                tft.print("v DOWN v");
-            }
+            view.up_enabled = (offset > 0);
+            view.down_enabled = (offset + DTC_ITEMS_PER_PAGE < dtc_count);
+            drawDTCUpButton(view.up_enabled);
+            drawDTCDownButton(view.down_enabled);
         }
     }
 }
 
+/**
+ * Offset the list was last drawn at (display task)
+ */
+inline int getDTCListOffset() {
+    return getDTCListView().offset;
+}
+
+/**
+ * Move the list on screen to the current scroll offset
+ * Header, action buttons and nav stay untouched: rows entering the view are
+ * rendered into their bitmap once, every screen row then gets the union of
+ * its old and new text extents pushed from the cached bitmaps. All rows
+ * shift, so a step costs the text area of the whole list (~18k pixels
+ * typical, ~27k with the longest texts; a full redraw is 154k) - the ILI9488
+ * hardware scroll would move only the entering row, but in this rotation it
+ * scrolls screen X. The range line and scroll buttons whose state flipped
+ * are redrawn. Without PSRAM the rows are drawn directly, same areas.
+ * @param dtc_data DTC list (same list as the last full redraw)
+ * @param dtc_count Number of DTCs
+ * @return true if a scroll button was redrawn (button highlight must be refreshed)
+ */
+inline bool scrollDTCList(const DTC* dtc_data, int dtc_count) {
+    DTCListView& view = getDTCListView();
+    if (view.rows < DTC_ITEMS_PER_PAGE || dtc_count <= DTC_ITEMS_PER_PAGE) return false;
+
+    // Clamp first: a stale offset past a shortened list must not push every row again
+    int offset = max(0, min(dtc_scroll_offset, dtc_count - DTC_ITEMS_PER_PAGE));
+    if (offset == view.offset) return false;
+
+    // Rasterize entering rows before any push (earlier pushes may still read the bitmaps)
+    DTCRowCache& cache = getDTCRowCache();
+    int slots[DTC_ITEMS_PER_PAGE];
+    for (int row = 0; row < DTC_ITEMS_PER_PAGE; row++) {
+        slots[row] = getDTCRowBitmap(dtc_data, offset + row, offset);
+    }
+
+    for (int row = 0; row < DTC_ITEMS_PER_PAGE; row++) {
+        const DTC& dtc = dtc_data[offset + row];
+        int row_y = DTC_LIST_Y + row * DTC_ROW_HEIGHT;
+        DTCRowExtent extent = (slots[row] >= 0) ? cache.extent[slots[row]] : measureDTCRow(dtc);
+        DirtyRect code_line = dirtyRectUnion(view.shown[row].code_line, extent.code_line);
+        DirtyRect description = dirtyRectUnion(view.shown[row].description, extent.description);
+        view.shown[row] = extent;
+
+        if (slots[row] >= 0) {
+            TFT_eSprite& sprite = *cache.sprite[slots[row]];
+            pushDTCRowArea(sprite, code_line, row_y);
+            pushDTCRowArea(sprite, description, row_y);
+            continue;
+        }
+
+        // Fallback: clear the old text, draw the new row
+        displayFlush();
+        displayFillRect(code_line.x, row_y + code_line.y, code_line.w, code_line.h, COLOR_BLACK);
+        if (!dirtyRectEmpty(description)) {
+            displayFillRect(description.x, row_y + description.y, description.w, description.h, COLOR_BLACK);
+        }
+        drawDTCRowText(tft, dtc, row_y);
+    }
+    view.offset = offset;
+
+    // Direct draws below - wait for the row pushes
+    displayFlush();
+    drawDTCListHeader(dtc_count, offset);
+
+    bool up_enabled = (offset > 0);
+    bool down_enabled = (offset + DTC_ITEMS_PER_PAGE < dtc_count);
+    bool buttons_redrawn = false;
+    if (up_enabled != view.up_enabled) {
+        drawDTCUpButton(up_enabled);
+        view.up_enabled = up_enabled;
+        buttons_redrawn = true;
+    }
+    if (down_enabled != view.down_enabled) {
+        drawDTCDownButton(down_enabled);
+        view.down_enabled = down_enabled;
+        buttons_redrawn = true;
+    }
+    return buttons_redrawn;
+}
+
+// ============================================================================
+// DETAIL VIEW
+// ============================================================================
+
+/**
+ * Label, unit and precision of a freeze-frame signal
+ */
+inline void getFreezeFrameSignal(uint8_t pid, const char*& label, const char*& unit, uint8_t& decimals) {
+    decimals = 0;
+    switch (pid) {
+        case PID_RPM:             label = "Engine RPM";  unit = " rpm";  break;
+        case PID_SPEED:           label = "Speed";       unit = " km/h"; break;
+        case PID_COOLANT_TEMP:    label = "Coolant";     unit = " C";    break;
+        case PID_INTAKE_TEMP:     label = "Intake air";  unit = " C";    break;
+        case PID_ENGINE_LOAD:     label = "Engine load"; unit = " %";    decimals = 1; break;
+        case PID_THROTTLE:        label = "Throttle";    unit = " %";    decimals = 1; break;
+        case PID_BATTERY_VOLTAGE: label = "Battery";     unit = " V";    decimals = 1; break;
+        case PID_MAP:             label = "MAP";         unit = " kPa";  break;
+        case PID_MAF:             label = "MAF";         unit = " g/s";  decimals = 1; break;
+        case PID_BARO:            label = "Baro";        unit = " kPa";  break;
+        default:                  label = "?";           unit = "";      break;
+    }
+}
+
+/**
+ * Draw the detail view of one code (drawn once per full redraw)
+ * @param info Vehicle info (DTC list and freeze frames)
+ * @param index Code to show (< info.dtc_count)
+ */
+inline void drawDTCDetail(const VehicleInfo& info, int index) {
+    const DTC& dtc = info.dtc_codes[index];
+    int y = CONTENT_Y_START + 5;
+
+    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(10, y);
+    tft.printf("Code %d of %d | Freeze frames: %d", index + 1, info.dtc_count, info.freeze_frame_count);
+
+    drawDTCHeaderButton(DTC_DETAIL_BTN_X, y - 2, DTC_DETAIL_BTN_W, "NEXT");
+
+    y += 25;
+    tft.drawLine(5, y, SCREEN_WIDTH - 5, y, COLOR_GRAY);
+    y += 5;
+
+    // Code, severity and status (as in the list)
+    uint16_t severity_color;
+    const char* severity_badge;
+    getDTCSeverityStyle(dtc.severity, severity_color, severity_badge);
+
+    tft.setTextColor(severity_color, COLOR_BLACK);
+    tft.setTextSize(2);
+    tft.setCursor(10, y);
+    tft.print(dtc.code);
+
+    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(85, y + 5);
+    tft.printf("[%s]", severity_badge);
+
+    tft.setTextColor(COLOR_GRAY, COLOR_BLACK);
+    tft.setCursor(125, y + 5);
+    if (dtc.status & DTC_STATUS_STORED) tft.print("STORED ");
+    if (dtc.status & DTC_STATUS_PENDING) tft.print("PENDING ");
+    if (dtc.status & DTC_STATUS_PERMANENT) tft.print("PERMANENT");
+
+    y += 22;
+
+    // Full description (the list truncates it)
+    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(10, y);
+    char description[79];
+    strncpy(description, dtc.description, sizeof(description) - 1);
+    description[sizeof(description) - 1] = '\0';
+    tft.print(description);
+
+    y += 13;
+    tft.drawLine(5, y, SCREEN_WIDTH - 5, y, COLOR_DARKGRAY);
+    y += 10;
+
+    const FreezeFrame* frame = findFreezeFrame(info, dtc.raw);
+    if (frame == NULL) {
+        tft.setTextColor(COLOR_GRAY, COLOR_BLACK);
+        tft.setTextSize(2);
+        tft.setCursor(10, y);
+        tft.print("No freeze frame");
+
+        tft.setTextSize(1);
+        tft.setCursor(10, y + 24);
+        tft.print("The ECU stores the conditions only for the code that set the frame");
+        return;
+    }
+
+    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(10, y);
+    tft.printf("Freeze frame %d - conditions when the code was stored", frame->frame);
+    y += 16;
+
+    // One signal per line: label left, value right of it
+    tft.setTextSize(2);
+    for (uint8_t i = 0; i < FREEZE_FRAME_PID_COUNT; i++) {
+        const char* label;
+        const char* unit;
+        uint8_t decimals;
+        getFreezeFrameSignal(freeze_frame_pids[i], label, unit, decimals);
+
+        char value[16];
+        bool valid = (frame->valid_mask & (1 << i)) != 0;
+        metricFormat(value, sizeof(value),
+                     valid ? metricQuantize(frame->values[i], decimals) : METRIC_NO_VALUE,
+                     decimals, unit);
+
+        tft.setTextColor(COLOR_GRAY, COLOR_BLACK);
+        tft.setCursor(20, y);
+        tft.print(label);
+        tft.setTextColor(valid ? COLOR_WHITE : COLOR_GRAY, COLOR_BLACK);
+        tft.setCursor(200, y);
+        tft.print(value);
+        y += 24;
+    }
+}
+
+/**
+ * Open the detail view (first code on screen), or step to the next code
+ * @param dtc_count Current DTC count
+ * @return false if the last code was shown (back to the list)
+ */
+inline bool selectNextDTCDetail(int dtc_count) {
+    int index = getDTCDetailIndex(dtc_count);
+    int next = (index < 0) ? dtc_scroll_offset : index + 1;
+    dtc_detail_index = (next < dtc_count) ? next : -1;
+    return dtc_detail_index >= 0;
+}
+
+/**
+ * Back to the list view
+ */
+inline void closeDTCDetail() {
+    dtc_detail_index = -1;
+}
+
 /**
  * Reset scroll offset (call when page is opened)
  */
 inline void resetDTCScroll() {
     dtc_scroll_offset = 0;
+    dtc_detail_index = -1;
 }
 
 /**
- * Scroll up (show previous DTCs)
+ * Scroll up one row (show the previous DTC)
  */
 inline void scrollDTCUp() {
     if (dtc_scroll_offset > 0) {
-        dtc_scroll_offset -= DTC_ITEMS_PER_PAGE;
-        if (dtc_scroll_offset < 0) {
-            dtc_scroll_offset = 0;
-        }
+        dtc_scroll_offset--;
     }
 }
 
 /**
- * Scroll down (show next DTCs)
+ * Scroll down one row (show the next DTC)
  */
 inline void scrollDTCDown(int dtc_count) {
     if (dtc_scroll_offset + DTC_ITEMS_PER_PAGE < dtc_count) {
-        dtc_scroll_offset += DTC_ITEMS_PER_PAGE;
+        dtc_scroll_offset++;
     }
 }
 
@@ -0,0 +1,277 @@
+/**
+ * Graph Page - Scrolling trend of one PID (hidden page under the Dashboard tab)
+ *
+ * Plots the recent samples of pid_history.h, one column per sample:
+ * - Sample n is drawn at column n % GRAPH_PLOT_W; a blank gap column
+ *   just after the newest sample marks the write position (sweep trace)
+ * - A frame draws only the columns of samples that arrived since the last
+ *   frame, each as a 1 x GRAPH_PLOT_H window write, plus the gap column
+ * - Axis, grid and labels are static chrome (chrome_cache.h)
+ *
+ * The plot is never shifted on the panel: an ILI9488 scroll moves the whole
+ * 480 px axis (top bar and nav included) and a redraw of the plot would not
+ * fit the pixel budget at the polling rate. A few hundred pixels per sample do.
+ *
+ * Opened by pressing SELECT on the Dashboard tab past the last layout;
+ * further presses step through the signals, then back to the dashboard.
+ */
+
+#ifndef GRAPH_PAGE_H
+#define GRAPH_PAGE_H
+
+#include <atomic>
+#include "ui_common.h"
+#include "display_writer.h"
+#include "metric_widget.h"
+#include "../obd2/pid_history.h"
+
+// Plot area (screen coordinates)
+#define GRAPH_PLOT_X        44
+#define GRAPH_PLOT_Y        (CONTENT_Y_START + 28)
+#define GRAPH_PLOT_W        (SCREEN_WIDTH - GRAPH_PLOT_X - 8)
+#define GRAPH_PLOT_H        196
+#define GRAPH_GRID_ROWS     4      // Horizontal grid divisions
+#define GRAPH_GRID_DOT      4      // Grid dot spacing (px)
+
+// Latest value (top right, above the plot)
+#define GRAPH_VALUE_W       96
+#define GRAPH_VALUE_SIZE    2
+
+struct GraphSignal {
+    uint8_t pid;            // Mode 01 PID (pid_history.h ring)
+    const char* title;      // Top bar page name
+    const char* unit;       // Axis unit
+    uint8_t decimals;       // Label/value precision
+    float min;              // Bottom of the plot
+    float max;              // Top of the plot
+    uint16_t color;         // Trace color
+};
+
+static const GraphSignal graph_signals[] = {
+    {PID_RPM,             "RPM Trend",      "rpm",  0, 0,   7000, COLOR_GREEN},
+    {PID_SPEED,           "Speed Trend",    "km/h", 0, 0,   200,  COLOR_CYAN},
+    {PID_THROTTLE,        "Throttle Trend", "%",    0, 0,   100,  COLOR_YELLOW},
+    {PID_COOLANT_TEMP,    "Coolant Trend",  "C",    0, 0,   130,  COLOR_ORANGE},
+    {PID_INTAKE_TEMP,     "Intake Trend",   "C",    0, -20, 80,   COLOR_ORANGE},
+    {PID_BATTERY_VOLTAGE, "Battery Trend",  "V",    1, 10,  16,   COLOR_MAGENTA},
+};
+
+#define GRAPH_SIGNAL_COUNT  (sizeof(graph_signals) / sizeof(graph_signals[0]))
+
+// ============================================================================
+// SIGNAL SELECTION (input loop writes, display task reads)
+// ============================================================================
+
+inline std::atomic<uint8_t>& graphSignalSelection() {
+    static std::atomic<uint8_t> selected(0);
+    return selected;
+}
+
+/**
+ * Signal shown by the graph page
+ */
+inline uint8_t getGraphSignal() {
+    return graphSignalSelection().load();
+}
+
+/**
+ * Show the first signal (page is being opened)
+ */
+inline void resetGraphSignal() {
+    graphSignalSelection().store(0);
+}
+
+/**
+ * Step to the next signal
+ * @return false if the last signal was shown (selection wraps to the first)
+ */
+inline bool selectNextGraphSignal() {
+    uint8_t next = getGraphSignal() + 1;
+    graphSignalSelection().store(next < GRAPH_SIGNAL_COUNT ? next : 0);
+    return next < GRAPH_SIGNAL_COUNT;
+}
+
+inline const GraphSignal& getGraphSignalInfo(uint8_t index) {
+    return graph_signals[index < GRAPH_SIGNAL_COUNT ? index : 0];
+}
+
+// ============================================================================
+// PLOT COLUMNS
+// ============================================================================
+
+/**
+ * Pixel in pushImage byte order (sprite format, see displayPushImage)
+ */
+inline uint16_t graphPixel(uint16_t color) {
+    return (uint16_t)((color >> 8) | (color << 8));
+}
+
+/**
+ * Plot row of a value (0 = top), clamped to the plot
+ */
+inline int16_t graphRow(const GraphSignal& signal, float value) {
+    float ratio = (value - signal.min) / (signal.max - signal.min);
+    int16_t row = (int16_t)lroundf((1.0f - ratio) * (GRAPH_PLOT_H - 1));
+    if (row < 0) return 0;
+    if (row > GRAPH_PLOT_H - 1) return GRAPH_PLOT_H - 1;
+    return row;
+}
+
+/**
+ * Whether a plot pixel lies on the dotted grid (same rule as the chrome)
+ */
+inline bool isGraphGridPixel(int16_t col, int16_t row) {
+    if (col % GRAPH_GRID_DOT != 0) return false;
+    for (uint8_t i = 0; i <= GRAPH_GRID_ROWS; i++) {
+        if (row == i * (GRAPH_PLOT_H - 1) / GRAPH_GRID_ROWS) return true;
+    }
+    return false;
+}
+
+/**
+ * Write one plot column: background and grid, plus a trace segment
+ * @param col Plot column (0 .. GRAPH_PLOT_W - 1)
+ * @param from_row First trace row (-1 = blank column)
+ * @param to_row Last trace row
+ * @param color Trace color
+ */
+inline void drawGraphColumn(int16_t col, int16_t from_row, int16_t to_row, uint16_t color) {
+    static uint16_t column[GRAPH_PLOT_H];
+
+    if (from_row > to_row) {
+        int16_t swap = from_row;
+        from_row = to_row;
+        to_row = swap;
+    }
+
+    const uint16_t background = graphPixel(COLOR_BLACK);
+    const uint16_t grid = graphPixel(COLOR_DARKGRAY);
+    const uint16_t trace = graphPixel(color);
+    for (int16_t row = 0; row < GRAPH_PLOT_H; row++) {
+        if (from_row >= 0 && row >= from_row && row <= to_row) {
+            column[row] = trace;
+        } else {
+            column[row] = isGraphGridPixel(col, row) ? grid : background;
+        }
+    }
+    displayPushImage(GRAPH_PLOT_X + col, GRAPH_PLOT_Y, 1, GRAPH_PLOT_H, column);
+}
+
+/**
+ * Draw the column of one sample, joined to the previous sample
+ * @param signal Signal being plotted
+ * @param seq Sample sequence number
+ */
+inline void drawGraphSample(const GraphSignal& signal, uint32_t seq) {
+    int16_t col = seq % GRAPH_PLOT_W;
+
+    PIDSample sample;
+    if (!pidHistoryRead(signal.pid, seq, sample)) {
+        drawGraphColumn(col, -1, -1, signal.color);  // Overwritten meanwhile - leave a hole
+        return;
+    }
+
+    int16_t row = graphRow(signal, sample.value);
+    int16_t prev_row = row;
+
+    // Vertical segment from the previous sample (no line across polling gaps)
+    PIDSample prev;
+    if (seq > 0 && pidHistoryRead(signal.pid, seq - 1, prev) &&
+        sample.time_ms - prev.time_ms <= GRAPH_GAP_MS) {
+        prev_row = graphRow(signal, prev.value);
+        // Previous column holds the segment up to prev_row - start next to it
+        if (prev_row < row) prev_row++;
+        else if (prev_row > row) prev_row--;
+    }
+    drawGraphColumn(col, prev_row, row, signal.color);
+}
+
+// ============================================================================
+// PAGE
+// ============================================================================
+
+/**
+ * Draw axis, grid and labels (part of the page chrome, black background)
+ * @param signal_index Signal shown
+ * @param gfx Draw target (panel, or the chrome cache frame)
+ */
+inline void drawGraphFrames(uint8_t signal_index, TFT_eSPI& gfx = tft) {
+    const GraphSignal& signal = getGraphSignalInfo(signal_index);
+    char text[40];
+
+    gfx.drawRect(GRAPH_PLOT_X - 1, GRAPH_PLOT_Y - 1, GRAPH_PLOT_W + 2, GRAPH_PLOT_H + 2, COLOR_GRAY);
+
+    // Dotted grid (plot columns repeat it, see isGraphGridPixel)
+    for (uint8_t i = 0; i <= GRAPH_GRID_ROWS; i++) {
+        int16_t row = i * (GRAPH_PLOT_H - 1) / GRAPH_GRID_ROWS;
+        for (int16_t col = 0; col < GRAPH_PLOT_W; col += GRAPH_GRID_DOT) {
+            gfx.drawPixel(GRAPH_PLOT_X + col, GRAPH_PLOT_Y + row, COLOR_DARKGRAY);
+        }
+
+        // Axis label (value of the grid line)
+        float value = signal.max - (signal.max - signal.min) * i / GRAPH_GRID_ROWS;
+        metricFormat(text, sizeof(text), metricQuantize(value, signal.decimals),
+                     signal.decimals, "");
+        gfx.setTextColor(COLOR_GRAY, COLOR_BLACK);
+        gfx.setTextSize(1);
+        gfx.setTextDatum(TL_DATUM);
+        gfx.drawString(text, 4, GRAPH_PLOT_Y + row - (i == 0 ? 0 : (i == GRAPH_GRID_ROWS ? 7 : 3)));
+    }
+
+    snprintf(text, sizeof(text), "%s, one column per sample", signal.unit);
+    gfx.setTextColor(COLOR_CYAN, COLOR_BLACK);
+    gfx.drawString(text, GRAPH_PLOT_X, CONTENT_Y_START + 10);
+
+    gfx.setTextColor(COLOR_GRAY, COLOR_BLACK);
+    gfx.drawString("SELECT on Dashboard: next signal", GRAPH_PLOT_X, GRAPH_PLOT_Y + GRAPH_PLOT_H + 4);
+
+    // Reset text settings to prevent corruption
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.setTextSize(1);
+}
+
+/**
+ * Draw samples that arrived since the last call
+ * @param signal_index Signal shown (changes only together with a full redraw)
+ * @param force_full_redraw Screen was redrawn - plot the whole history again
+ */
+inline void drawGraphPage(uint8_t signal_index, bool force_full_redraw) {
+    static uint32_t next_seq = 0;       // First sample not drawn yet
+    static DirtyRect value_extent = dirtyRectNone();
+
+    const GraphSignal& signal = getGraphSignalInfo(signal_index);
+    uint32_t count = pidHistoryCount(signal.pid);
+
+    // One column stays blank as the gap, so at most GRAPH_PLOT_W - 1 samples are on screen
+    const uint32_t visible = GRAPH_PLOT_W - 1;
+    if (force_full_redraw) {
+        next_seq = count > visible ? count - visible : 0;
+        value_extent = dirtyRectNone();
+    } else if (count - next_seq > visible) {
+        next_seq = count - visible;     // Fell behind by more than one sweep
+    }
+    if (next_seq == count) return;
+
+    for (uint32_t seq = next_seq; seq < count; seq++) {
+        drawGraphSample(signal, seq);
+    }
+    drawGraphColumn(count % GRAPH_PLOT_W, -1, -1, signal.color);  // Gap ahead of the trace
+    next_seq = count;
+
+    // Latest value above the plot
+    PIDSample latest;
+    if (pidHistoryRead(signal.pid, count - 1, latest)) {
+        char text[16];
+        metricFormat(text, sizeof(text), metricQuantize(latest.value, signal.decimals),
+                     signal.decimals, "");
+        drawValueCell(SCREEN_WIDTH - 8 - GRAPH_VALUE_W, CONTENT_Y_START + 6, GRAPH_VALUE_W,
+                      GRAPH_VALUE_SIZE * VALUE_GLYPH_HEIGHT, text, GRAPH_VALUE_SIZE,
+                      signal.color, value_extent);
+
+        // Reset text settings to prevent corruption
+        tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+        tft.setTextSize(1);
+    }
+}
+
+#endif // GRAPH_PAGE_H
@@ -0,0 +1,112 @@
+/**
+ * Metric Format - Fixed-point value handling for metric widgets
+ *
+ * Values are compared and formatted at display precision
+ * (87.34 °C at 1 decimal -> 873):
+ * - Quantize once, compare integers
+ * - Format with integer math (no float printf)
+ * - Decide whether a changed value is drawn now or held back by its update rate
+ *
+ * No TFT dependencies (shared by metric_widget.h and the host benchmarks)
+ */
+
+#ifndef METRIC_FORMAT_H
+#define METRIC_FORMAT_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Nothing drawn yet (forces the next update)
+#define METRIC_NONE         INT32_MIN
+
+// Value not known (NAN input, shown as "--")
+#define METRIC_NO_VALUE     (INT32_MIN + 1)
+
+// Value cell inside the box (below the label, height follows the value font)
+#define METRIC_VALUE_X      5
+#define METRIC_VALUE_Y      30
+#define METRIC_VALUE_CHARS  7      // Widest value text (bounds the sprite in wide boxes)
+#define METRIC_GLYPH_WIDTH  6      // GLCD glyph advance at text size 1
+
+/**
+ * Scale factor for a precision (10^decimals)
+ */
+inline int32_t metricScale(uint8_t decimals) {
+    return decimals == 0 ? 1 : (decimals == 1 ? 10 : 100);
+}
+
+/**
+ * Quantize value to display precision (round half away from zero)
+ * @return Value in units of 10^-decimals (METRIC_NO_VALUE for NAN)
+ */
+inline int32_t metricQuantize(float value, uint8_t decimals) {
+    if (isnan(value)) return METRIC_NO_VALUE;
+    return (int32_t)lroundf(value * metricScale(decimals));
+}
+
+/**
+ * Format quantized value with integer math, e.g. (873, 1, "") -> "87.3"
+ * @param buffer Output buffer
+ * @param size Buffer size
+ * @param quantized Value in units of 10^-decimals
+ * @param decimals Fixed-point precision
+ * @param suffix Text appended to the number
+ */
+inline void metricFormat(char* buffer, size_t size, int32_t quantized, uint8_t decimals,
+                         const char* suffix) {
+    if (quantized == METRIC_NO_VALUE) {
+        snprintf(buffer, size, "--");
+        return;
+    }
+    if (decimals == 0) {
+        snprintf(buffer, size, "%ld%s", (long)quantized, suffix);
+        return;
+    }
+
+    // metricScale() stops at 2 decimals - the fraction is 1 or 2 digits
+    int32_t scale = metricScale(decimals);
+    int width = (scale == 10) ? 1 : 2;
+    long magnitude = labs((long)quantized);
+    snprintf(buffer, size, "%s%ld.%0*d%s", quantized < 0 ? "-" : "",
+             magnitude / scale, width, (int)(magnitude % scale), suffix);
+}
+
+enum MetricChange : uint8_t {
+    METRIC_UNCHANGED = 0,   // Same value at display precision
+    METRIC_HELD,            // Changed, but within update_ms of the last redraw
+    METRIC_REDRAW           // Draw now
+};
+
+/**
+ * Decide what to do with a new quantized value
+ * @param shown Quantized value on screen (METRIC_NONE = nothing drawn)
+ * @param quantized New quantized value
+ * @param update_ms Minimum time between redraws (0 = every change)
+ * @param last_draw_ms Time of the last redraw
+ * @param now Current time (ms)
+ */
+inline MetricChange metricChange(int32_t shown, int32_t quantized, uint16_t update_ms,
+                                 uint32_t last_draw_ms, uint32_t now) {
+    if (quantized == shown) return METRIC_UNCHANGED;
+
+    // First value after a clear is always drawn
+    if (shown != METRIC_NONE && update_ms > 0 && now - last_draw_ms < update_ms) {
+        return METRIC_HELD;
+    }
+    return METRIC_REDRAW;
+}
+
+/**
+ * Width of the value cell in a box: centered, no wider than the widest value text
+ * @param box_w Box width
+ * @param value_size GLCD text size of the value
+ */
+inline int16_t metricValueCellWidth(int16_t box_w, uint8_t value_size) {
+    int16_t cell_w = box_w - 2 * METRIC_VALUE_X;
+    int16_t max_w = METRIC_VALUE_CHARS * METRIC_GLYPH_WIDTH * value_size;
+    return cell_w > max_w ? max_w : cell_w;
+}
+
+#endif // METRIC_FORMAT_H
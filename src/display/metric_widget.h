@@ -0,0 +1,129 @@
+/**
+ * Metric Widget - Boxed numeric gauge with fixed-point change detection
+ *
+ * Each widget remembers the value it currently shows, quantized to its
+ * display precision (87.34 °C at 1 decimal -> 873, see metric_format.h):
+ * - A frame compares integers only, no text is formatted for unchanged values
+ * - Text is built with integer math (no float printf) when the value changes
+ * - The new text is pushed as a dirty rectangle (value_renderer.h)
+ */
+
+#ifndef METRIC_WIDGET_H
+#define METRIC_WIDGET_H
+
+#include "ui_common.h"
+#include "metric_format.h"
+#include "value_renderer.h"
+
+struct MetricWidget {
+    const char* label;      // Box label, e.g. "Coolant (C)"
+    const char* suffix;     // Appended to the value ("%", "V" or "")
+    uint8_t decimals;       // Fixed-point precision (0-2)
+    uint8_t value_size;     // GLCD text size of the value
+    uint16_t update_ms;     // Minimum time between value redraws (0 = every change)
+    int16_t x, y, w, h;     // Box (screen coordinates)
+    int32_t shown;          // Quantized value on screen (METRIC_NONE = nothing drawn)
+    uint32_t last_draw_ms;  // Time of the last value redraw
+    bool pending;           // Changed value held back by update_ms
+    DirtyRect extent;       // Value text drawn last time (cell coordinates)
+};
+
+/**
+ * Time until a held-back value may be drawn
+ * @return ms until the next redraw is allowed (0 if nothing is pending)
+ */
+inline uint32_t metricWidgetDueIn(const MetricWidget& widget, uint32_t now) {
+    if (!widget.pending) return 0;
+    uint32_t elapsed = now - widget.last_draw_ms;
+    return elapsed >= widget.update_ms ? 1 : widget.update_ms - elapsed;
+}
+
+/**
+ * Set up a widget (nothing is drawn until the first update after drawMetricWidgetFrame)
+ * @param value_size GLCD text size of the value
+ * @param update_ms Minimum time between value redraws (0 = every change)
+ */
+inline void initMetricWidget(MetricWidget& widget, const char* label, const char* suffix,
+                             uint8_t decimals, uint8_t value_size, uint16_t update_ms,
+                             int16_t x, int16_t y, int16_t w, int16_t h) {
+    widget.label = label;
+    widget.suffix = suffix;
+    widget.decimals = decimals;
+    widget.value_size = value_size;
+    widget.update_ms = update_ms;
+    widget.last_draw_ms = 0;
+    widget.pending = false;
+    widget.x = x;
+    widget.y = y;
+    widget.w = w;
+    widget.h = h;
+    widget.shown = METRIC_NONE;
+    widget.extent = dirtyRectNone();
+}
+
+/**
+ * Forget the shown value after the screen was cleared (next update redraws it)
+ * @param widget Widget whose box was just redrawn
+ */
+inline void resetMetricWidget(MetricWidget& widget) {
+    widget.shown = METRIC_NONE;
+    widget.pending = false;
+    widget.extent = dirtyRectNone();  // Screen was cleared - no old text left
+}
+
+/**
+ * Draw box border and label (static part, on a black background)
+ * @param widget Widget to draw
+ * @param label_color Label text color
+ * @param gfx Draw target (panel, or the chrome cache frame)
+ */
+inline void drawMetricWidgetFrame(const MetricWidget& widget, uint16_t label_color,
+                                  TFT_eSPI& gfx = tft) {
+    // Finish pending value pushes before drawing directly
+    if (&gfx == &tft) displayFlush();
+
+    gfx.drawRect(widget.x, widget.y, widget.w, widget.h, COLOR_GRAY);
+
+    gfx.setTextColor(label_color, COLOR_BLACK);
+    gfx.setTextSize(2);
+    gfx.setCursor(widget.x + 10, widget.y + 8);
+    gfx.print(widget.label);
+
+    // Reset text settings to prevent corruption
+    gfx.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    gfx.setTextSize(1);
+}
+
+/**
+ * Show a new value if it differs from the shown one at display precision
+ * A change within update_ms of the last redraw is held back (widget.pending)
+ * @param widget Widget to update
+ * @param value Current value
+ * @param now Current time (ms)
+ * @return true if the value cell was redrawn
+ */
+inline bool updateMetricWidget(MetricWidget& widget, float value, uint32_t now) {
+    int32_t quantized = metricQuantize(value, widget.decimals);
+    MetricChange change = metricChange(widget.shown, quantized, widget.update_ms,
+                                       widget.last_draw_ms, now);
+    widget.pending = (change == METRIC_HELD);
+    if (change != METRIC_REDRAW) return false;
+
+    // Value cell: centered, no wider than the widest value text
+    int16_t cell_w = metricValueCellWidth(widget.w, widget.value_size);
+    int16_t cell_h = widget.value_size * VALUE_GLYPH_HEIGHT + 4;
+
+    char text[16];
+    metricFormat(text, sizeof(text), quantized, widget.decimals, widget.suffix);
+    drawValueCell(widget.x + (widget.w - cell_w) / 2, widget.y + METRIC_VALUE_Y,
+                  cell_w, cell_h, text, widget.value_size, COLOR_WHITE, widget.extent);
+    widget.shown = quantized;
+    widget.last_draw_ms = now;
+
+    // Reset text settings to prevent corruption
+    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    tft.setTextSize(1);
+    return true;
+}
+
+#endif // METRIC_WIDGET_H
@@ -6,6 +6,7 @@
 #define NAV_BAR_H
 
 #include "ui_common.h"
+#include "display_writer.h"
 
 // ============================================================================
 // TOP BAR
@@ -17,40 +18,37 @@
  * @param page_name Current page name (center)
  * @param status_color Status indicator color (green/yellow/red)
  * @param dtc_count Number of diagnostic trouble codes
+ * @param gfx Draw target (panel, or the chrome cache frame)
  */
 inline void drawTopBar(const char* vehicle_name, const char* page_name,
-                       uint16_t status_color, int dtc_count) {
-    // Background - USE STRIPS for large area (480×40 = 19,200 pixels > 10k limit)
-    const int strip_height = 10;
-    for (int y = 0; y < TOP_BAR_HEIGHT; y += strip_height) {
-        tft.fillRect(0, y, SCREEN_WIDTH, strip_height, COLOR_DARKGRAY);
-        delay(10);  // Required delay after fillRect
-    }
+                       uint16_t status_color, int dtc_count, TFT_eSPI& gfx = tft) {
+    // Background - paced fill, split into strips (480×35 = 16,800 pixels)
+    displayFillRectOn(gfx, 0, 0, SCREEN_WIDTH, TOP_BAR_HEIGHT, COLOR_DARKGRAY);
 
     // Vehicle name (left)
-    tft.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
-    tft.setTextSize(2);
-    tft.setCursor(5, 10);
-    tft.print(vehicle_name);
+    gfx.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
+    gfx.setTextSize(2);
+    gfx.setCursor(5, 10);
+    gfx.print(vehicle_name);
 
     // Page name (center)
-    tft.setTextColor(COLOR_CYAN, COLOR_DARKGRAY);
+    gfx.setTextColor(COLOR_CYAN, COLOR_DARKGRAY);
     int page_name_width = strlen(page_name) * 12;
-    tft.setCursor((SCREEN_WIDTH - page_name_width) / 2, 10);
-    tft.print(page_name);
+    gfx.setCursor((SCREEN_WIDTH - page_name_width) / 2, 10);
+    gfx.print(page_name);
 
     // Status indicator (right)
     int status_x = SCREEN_WIDTH - 80;
-    tft.fillCircle(status_x, 17, 8, status_color);
+    gfx.fillCircle(status_x, 17, 8, status_color);
 
     // DTC count
     if (dtc_count > 0) {
         char dtc_text[16];
         snprintf(dtc_text, sizeof(dtc_text), "%d DTC", dtc_count);
-        tft.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
-        tft.setTextSize(1);
-        tft.setCursor(status_x + 15, 12);
-        tft.print(dtc_text);
+        gfx.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
+        gfx.setTextSize(1);
+        gfx.setCursor(status_x + 15, 12);
+        gfx.print(dtc_text);
     }
 }
 
@@ -61,26 +59,28 @@ inline void drawTopBar(const char* vehicle_name, const char* page_name,
 /**
  * Draw bottom navigation bar with 3 buttons
  * @param active_page Currently active page (highlighted)
+ * @param gfx Draw target (panel, or the chrome cache frame)
  */
-inline void drawBottomNav(Page active_page) {
+inline void drawBottomNav(Page active_page, TFT_eSPI& gfx = tft) {
     int y = BOTTOM_NAV_Y;
 
     // Draw buttons
     for (int i = 0; i < 3; i++) {
         int x = i * NAV_BUTTON_WIDTH;
-        bool is_active = (i == active_page);
+        // Hidden pages live under the Config (stats) and Dashboard (graph) tabs
+        bool is_active = (i == active_page) || (i == PAGE_CONFIG && active_page == PAGE_STATS) ||
+                         (i == PAGE_DASHBOARD && active_page == PAGE_GRAPH);
 
         // Button background (each button is 160×40 = 6,400 pixels)
         uint16_t bg_color = is_active ? COLOR_GRAY : COLOR_DARKGRAY;
-        tft.fillRect(x, y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, bg_color);
-        delay(20);  // Required delay after fillRect
+        displayFillRectOn(gfx, x, y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, bg_color);
 
         // Button border
-        tft.drawRect(x, y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, COLOR_GRAY);
+        gfx.drawRect(x, y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, COLOR_GRAY);
 
         // Button text
-        tft.setTextColor(COLOR_WHITE, bg_color);
-        tft.setTextSize(2);
+        gfx.setTextColor(COLOR_WHITE, bg_color);
+        gfx.setTextSize(2);
 
         const char* label;
         int text_x;
@@ -100,8 +100,8 @@ inline void drawBottomNav(Page active_page) {
                 break;
         }
 
-        tft.setCursor(text_x, y + 12);
-        tft.print(label);
+        gfx.setCursor(text_x, y + 12);
+        gfx.print(label);
     }
 }
 
@@ -1,7 +1,12 @@
 /**
  * Startup Screen - OBDeck Boot Animation
  *
- * Displays branded startup screen with animation (~3 seconds)
+ * Branded startup screen shown while the OBD2 task connects. Frame-stepped
+ * by the display task (no delays), so the connection runs in parallel:
+ * - Logo and vehicle info, then a scanning line (diagnostic theme)
+ * - Status line with the real connection progress (LiveData.link_stage)
+ * - Exits as soon as the first values are published, the connection
+ *   fails, or STARTUP_MAX_MS passed without data
  */
 
 #ifndef STARTUP_SCREEN_H
@@ -9,32 +14,78 @@
 
 #include <TFT_eSPI.h>
 #include "ui_common.h"
+#include "display_writer.h"
+#include "../obd2/obd_data.h"
 
 // External display object
 extern TFT_eSPI tft;
 
+// Scan area (diagnostic screen frame)
+#define STARTUP_SCAN_START_Y    160
+#define STARTUP_SCAN_END_Y      280
+#define STARTUP_SCAN_STEPS      60     // Line positions per sweep (one per frame)
+#define STARTUP_SCAN_TRAIL      3      // Steps until a line is erased again
+#define STARTUP_STATUS_Y        292    // Connection progress line
+
+enum StartupPhase : uint8_t {
+    STARTUP_BRANDING = 0,   // Logo only (STARTUP_BRANDING_MS)
+    STARTUP_SCAN,           // Scanning line + progress
+    STARTUP_DONE            // Pages take over
+};
+
+struct StartupScreen {
+    uint8_t phase;          // StartupPhase
+    uint8_t step;           // Next scan line position (0..STARTUP_SCAN_STEPS-1)
+    uint8_t shown_stage;    // LinkStage in the status line (0xFF = none yet)
+    uint32_t started_ms;
+    uint32_t last_step_ms;
+};
+
 /**
- * Show animated startup screen
- * Total duration: ~3 seconds
- *
- * Animation includes:
- * - OBDeck branding
- * - Vehicle information
- * - Scanning line effect (diagnostic theme)
- * - Clean cyan/white color scheme
+ * Status line text of a connection stage
  */
-void showStartupScreen() {
-    // Clear screen with strip-based fill for stability
-    for (int y = 0; y < SCREEN_HEIGHT; y += 10) {
-        tft.fillRect(0, y, SCREEN_WIDTH, 10, COLOR_BLACK);
-        delay(3);  // Fast clear (3ms * 32 strips = ~100ms)
+inline const char* startupStageText(uint8_t stage) {
+    switch (stage) {
+        case LINK_STAGE_BLUETOOTH: return "Connecting to adapter";
+        case LINK_STAGE_ADAPTER:   return "Initializing ELM327";
+        case LINK_STAGE_ECU:       return "Waiting for ECU";
+        case LINK_STAGE_VEHICLE:   return "Reading vehicle info";
+        default:                   return "READY";
     }
+}
 
-    delay(20);  // Brief settle time
+/**
+ * Y of a scan line position
+ */
+inline int startupScanY(uint8_t step) {
+    return STARTUP_SCAN_START_Y + (step * (STARTUP_SCAN_END_Y - STARTUP_SCAN_START_Y) / STARTUP_SCAN_STEPS);
+}
 
-    // ===================================================================
-    // PHASE 1: Logo & Branding (0-800ms)
-    // ===================================================================
+/**
+ * Draw a scan line (3 lines for thickness: gray, bright, gray) or erase it
+ */
+inline void drawStartupScanLine(uint8_t step, bool erase) {
+    const int32_t x = 45;
+    const int32_t w = SCREEN_WIDTH - 90;
+    int y = startupScanY(step);
+
+    displayFillRect(x, y - 1, w, 1, erase ? COLOR_BLACK : COLOR_GRAY);
+    displayFillRect(x, y, w, 1, erase ? COLOR_BLACK : COLOR_CYAN);
+    displayFillRect(x, y + 1, w, 1, erase ? COLOR_BLACK : COLOR_GRAY);
+}
+
+/**
+ * Draw the branding and reset the animation
+ * initDisplay() left the screen black, nothing is cleared
+ * @param screen Animation state
+ * @param now Current time (ms)
+ */
+inline void beginStartupScreen(StartupScreen& screen, uint32_t now) {
+    screen.phase = STARTUP_BRANDING;
+    screen.step = 0;
+    screen.shown_stage = 0xFF;
+    screen.started_ms = now;
+    screen.last_step_ms = now;
 
     // Draw main title "OBDeck"
     tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
@@ -52,89 +103,60 @@ void showStartupScreen() {
     tft.setTextSize(1);
     tft.drawString("2010 Opel Corsa D", SCREEN_WIDTH / 2, 140);
 
-    delay(200);  // Hold branding for visibility
-
-    // ===================================================================
-    // PHASE 2: Scanning Line Animation (800-2600ms)
-    // ===================================================================
-
-    const int SCAN_START_Y = 160;
-    const int SCAN_END_Y = 280;
-    const int SCAN_CYCLES = 3;      // Number of complete scans
-    const int SCAN_STEPS = 60;      // Steps per scan (smoother = more steps)
-    const int SCAN_DELAY = 10;      // Delay per step (10ms * 60 steps * 3 cycles = 1800ms)
-
-    // Draw scan area border (diagnostic screen frame)
-    tft.drawRect(40, SCAN_START_Y - 5, SCREEN_WIDTH - 80, SCAN_END_Y - SCAN_START_Y + 10, COLOR_GRAY);
-
-    for (int cycle = 0; cycle < SCAN_CYCLES; cycle++) {
-        for (int step = 0; step < SCAN_STEPS; step++) {
-            int y = SCAN_START_Y + (step * (SCAN_END_Y - SCAN_START_Y) / SCAN_STEPS);
-
-            // Draw scanning line with gradient effect (3 lines for thickness)
-            tft.drawLine(45, y - 1, SCREEN_WIDTH - 45, y - 1, COLOR_GRAY);
-            tft.drawLine(45, y, SCREEN_WIDTH - 45, y, COLOR_CYAN);      // Main bright line
-            tft.drawLine(45, y + 1, SCREEN_WIDTH - 45, y + 1, COLOR_GRAY);
-
-            // Erase previous line (draw black line behind)
-            if (step > 2) {
-                int prev_y = SCAN_START_Y + ((step - 3) * (SCAN_END_Y - SCAN_START_Y) / SCAN_STEPS);
-                tft.drawLine(45, prev_y - 1, SCREEN_WIDTH - 45, prev_y - 1, COLOR_BLACK);
-                tft.drawLine(45, prev_y, SCREEN_WIDTH - 45, prev_y, COLOR_BLACK);
-                tft.drawLine(45, prev_y + 1, SCREEN_WIDTH - 45, prev_y + 1, COLOR_BLACK);
-            }
-
-            delay(SCAN_DELAY);
-        }
-
-        // Clear last line at end of scan
-        int last_y = SCAN_END_Y;
-        tft.drawLine(45, last_y - 1, SCREEN_WIDTH - 45, last_y - 1, COLOR_BLACK);
-        tft.drawLine(45, last_y, SCREEN_WIDTH - 45, last_y, COLOR_BLACK);
-        tft.drawLine(45, last_y + 1, SCREEN_WIDTH - 45, last_y + 1, COLOR_BLACK);
-
-        delay(50);  // Brief pause between scans
-    }
-
-    // ===================================================================
-    // PHASE 3: Completion (2600-3000ms)
-    // ===================================================================
-
-    // Show "Ready" message
-    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("READY", SCREEN_WIDTH / 2, (SCAN_START_Y + SCAN_END_Y) / 2);
-
-    delay(350);  // Hold ready state
-
-    // Total time: ~100ms (clear) + 200ms + 1800ms (scan) + 350ms = ~2.45 seconds
+    tft.setTextDatum(TL_DATUM);
 }
 
 /**
- * Alternative: Simpler startup screen without animation
- * Duration: ~1 second
+ * Advance the animation by one frame
+ * Scan steps are paced to STARTUP_FRAME_MS, the status line is redrawn
+ * only when the stage changes (call early on connection events is fine)
+ * @param screen Animation state
+ * @param now Current time (ms)
+ * @param data Latest live block (link_stage, error)
+ * @return false once the startup screen is done (draw the pages)
  */
-void showStartupScreenSimple() {
-    // Clear screen quickly
-    for (int y = 0; y < SCREEN_HEIGHT; y += 10) {
-        tft.fillRect(0, y, SCREEN_WIDTH, 10, COLOR_BLACK);
-        delay(3);
+inline bool stepStartupScreen(StartupScreen& screen, uint32_t now, const LiveData& data) {
+    if (screen.phase == STARTUP_DONE) return false;
+
+    if (data.link_stage == LINK_STAGE_READY || data.error[0] != '\0' ||
+        now - screen.started_ms >= STARTUP_MAX_MS) {
+        screen.phase = STARTUP_DONE;
+        return false;
     }
-    delay(20);
 
-    // Show title
-    tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft.setTextSize(4);
-    tft.setTextDatum(MC_DATUM);  // Middle center
-    tft.drawString("OBDeck", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 30);
+    if (screen.phase == STARTUP_BRANDING) {
+        if (now - screen.started_ms < STARTUP_BRANDING_MS) return true;
 
-    // Show subtitle
-    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.drawString("OBD2 Dashboard", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 20);
+        // Scan area border
+        tft.drawRect(40, STARTUP_SCAN_START_Y - 5, SCREEN_WIDTH - 80,
+                     STARTUP_SCAN_END_Y - STARTUP_SCAN_START_Y + 10, COLOR_GRAY);
+        screen.phase = STARTUP_SCAN;
+        screen.last_step_ms = now - STARTUP_FRAME_MS;
+    }
+
+    if (data.link_stage != screen.shown_stage) {
+        tft.setTextColor(COLOR_CYAN, COLOR_BLACK);
+        tft.setTextSize(2);
+        tft.setTextDatum(TC_DATUM);
+        tft.setTextPadding(SCREEN_WIDTH - 80);  // Clears the previous text
+        displayReservePixels((SCREEN_WIDTH - 80) * 16);  // Padding fills 16 rows internally
+        tft.drawString(startupStageText(data.link_stage), SCREEN_WIDTH / 2, STARTUP_STATUS_Y);
+
+        tft.setTextPadding(0);
+        tft.setTextDatum(TL_DATUM);
+        tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+        tft.setTextSize(1);
+        screen.shown_stage = data.link_stage;
+    }
 
-    delay(800);  // Hold for visibility
+    if (now - screen.last_step_ms >= STARTUP_FRAME_MS) {
+        // Erase the line that left the trail (wraps into the previous sweep)
+        drawStartupScanLine((screen.step + STARTUP_SCAN_STEPS - STARTUP_SCAN_TRAIL) % STARTUP_SCAN_STEPS, true);
+        drawStartupScanLine(screen.step, false);
+        screen.step = (screen.step + 1) % STARTUP_SCAN_STEPS;
+        screen.last_step_ms = now;
+    }
+    return true;
 }
 
 #endif // STARTUP_SCREEN_H
@@ -0,0 +1,273 @@
+/**
+ * Stats Page - Runtime Metrics (hidden page)
+ *
+ * Opened by pressing SELECT on the Config tab while the Config page is shown;
+ * a second press switches to the tasks view, a third goes back to Config.
+ * - Link view: metrics/metrics.h counters - PID round-trip times and achieved
+ *   rates, ELM327 reply counters, frame time split and snapshot read times
+ * - Tasks view: metrics/profiler.h sample - core loads, heap and PSRAM,
+ *   input loop jitter, CPU share and stack headroom per FreeRTOS task
+ *
+ * Lines are fixed-width opaque text, so updates overwrite the old values
+ * without any fill.
+ */
+
+#ifndef STATS_PAGE_H
+#define STATS_PAGE_H
+
+#include <atomic>
+#include "ui_common.h"
+#include "../obd2/obd_data.h"
+#include "../metrics/metrics.h"
+#include "../metrics/profiler.h"
+
+#define STATS_LINE_CHARS    78     // Characters per line (GLCD size 1: 6 px each)
+#define STATS_LINE_HEIGHT   12     // Pixels per line
+#define STATS_CONTENT_END   (BOTTOM_NAV_Y - 12)  // Last line starts above this
+
+enum StatsView : uint8_t {
+    STATS_VIEW_LINK = 0,    // PIDs, ELM327, display, snapshots
+    STATS_VIEW_TASKS,       // Tasks, heap, loop jitter
+    STATS_VIEW_COUNT
+};
+
+// ============================================================================
+// VIEW SELECTION (input loop writes, display task reads)
+// ============================================================================
+
+inline std::atomic<uint8_t>& statsViewSelection() {
+    static std::atomic<uint8_t> selected(STATS_VIEW_LINK);
+    return selected;
+}
+
+/**
+ * View shown by the stats page
+ */
+inline uint8_t getStatsView() {
+    return statsViewSelection().load();
+}
+
+/**
+ * Show the first view (page is being opened)
+ */
+inline void resetStatsView() {
+    statsViewSelection().store(STATS_VIEW_LINK);
+}
+
+/**
+ * Step to the next view
+ * @return false if the last view was shown (selection wraps to the first)
+ */
+inline bool selectNextStatsView() {
+    uint8_t next = getStatsView() + 1;
+    statsViewSelection().store(next < STATS_VIEW_COUNT ? next : STATS_VIEW_LINK);
+    return next < STATS_VIEW_COUNT;
+}
+
+/**
+ * Top bar page name of a view
+ */
+inline const char* statsViewName(uint8_t view) {
+    return view == STATS_VIEW_TASKS ? "Tasks" : "Stats";
+}
+
+/**
+ * Draw one fixed-width line (padded with spaces to clear old text)
+ */
+inline void drawStatsLine(int y, uint16_t color, const char* text) {
+    char line[STATS_LINE_CHARS + 1];
+    snprintf(line, sizeof(line), "%-*s", STATS_LINE_CHARS, text);
+
+    tft.setTextColor(color, COLOR_BLACK);
+    tft.setTextSize(1);
+    tft.setTextDatum(TL_DATUM);
+    tft.drawString(line, 6, y);
+}
+
+// ============================================================================
+// LINK VIEW
+// ============================================================================
+
+/**
+ * Draw the link view (all lines are rewritten on every call)
+ */
+inline void drawLinkStats() {
+    uint32_t now = millis();
+    char text[96];
+    int y = CONTENT_Y_START + 6;
+
+    snprintf(text, sizeof(text), "Runtime Statistics          uptime %lus   (serial: send '%c' for dump)",
+             (unsigned long)(now / 1000), METRICS_DUMP_KEY);
+    drawStatsLine(y, COLOR_CYAN, text);
+    y += STATS_LINE_HEIGHT + 4;
+
+    // PID round trips and achieved rates
+    drawStatsLine(y, COLOR_GRAY, "Signal       Hz   RTT p50   p95   max ms   updates  failures");
+    y += STATS_LINE_HEIGHT;
+    for (uint8_t i = 0; i < METRIC_PID_COUNT; i++) {
+        const PIDMetrics& m = metrics.pids[i];
+        uint32_t hz_x10 = metricsRateHzX10(m.updates, now);
+        snprintf(text, sizeof(text), "%-9s %3lu.%lu   %7lu %5lu %5lu   %7lu  %8lu",
+                 metricsPIDName(i),
+                 (unsigned long)(hz_x10 / 10), (unsigned long)(hz_x10 % 10),
+                 (unsigned long)metricsPercentile(m.rtt_ms, 50),
+                 (unsigned long)metricsPercentile(m.rtt_ms, 95),
+                 (unsigned long)m.rtt_ms.max.load(std::memory_order_relaxed),
+                 (unsigned long)m.updates.total.load(std::memory_order_relaxed),
+                 (unsigned long)m.failures.load(std::memory_order_relaxed));
+        drawStatsLine(y, COLOR_WHITE, text);
+        y += STATS_LINE_HEIGHT;
+    }
+    y += 4;
+
+    // ELM327 command results
+    const ELMMetrics& elm = metrics.elm;
+    snprintf(text, sizeof(text), "ELM327   RTT p50 %lu  p95 %lu  max %lu ms",
+             (unsigned long)metricsPercentile(elm.rtt_ms, 50),
+             (unsigned long)metricsPercentile(elm.rtt_ms, 95),
+             (unsigned long)elm.rtt_ms.max.load(std::memory_order_relaxed));
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+    snprintf(text, sizeof(text), "         OK %lu  NO DATA %lu  errors %lu  timeouts %lu  overflows %lu",
+             (unsigned long)elm.ok.load(std::memory_order_relaxed),
+             (unsigned long)elm.no_data.load(std::memory_order_relaxed),
+             (unsigned long)elm.errors.load(std::memory_order_relaxed),
+             (unsigned long)elm.timeouts.load(std::memory_order_relaxed),
+             (unsigned long)elm.overflows.load(std::memory_order_relaxed));
+    drawStatsLine(y, elm.timeouts.load(std::memory_order_relaxed) > 0 ? COLOR_YELLOW : COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT + 4;
+
+    // Display frame times
+    const DisplayMetrics& d = metrics.display;
+    uint32_t fps_x10 = metricsRateHzX10(d.frames, now);
+    snprintf(text, sizeof(text), "Display  %lu.%lu fps   frame p50 %lu  p95 %lu  max %lu us",
+             (unsigned long)(fps_x10 / 10), (unsigned long)(fps_x10 % 10),
+             (unsigned long)metricsPercentile(d.frame_us, 50),
+             (unsigned long)metricsPercentile(d.frame_us, 95),
+             (unsigned long)d.frame_us.max.load(std::memory_order_relaxed));
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+    snprintf(text, sizeof(text), "         per frame: fill %lu  text %lu  wait %lu us",
+             (unsigned long)d.avg_fill_us.load(std::memory_order_relaxed),
+             (unsigned long)d.avg_text_us.load(std::memory_order_relaxed),
+             (unsigned long)d.avg_wait_us.load(std::memory_order_relaxed));
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT + 4;
+
+    // Snapshot reads (SeqLock) on both cores
+    snprintf(text, sizeof(text), "Snapshot read  core0 p95 %lu max %lu us   core1 p95 %lu max %lu us",
+             (unsigned long)metricsPercentile(metrics.snapshot_wait_us[0], 95),
+             (unsigned long)metrics.snapshot_wait_us[0].max.load(std::memory_order_relaxed),
+             (unsigned long)metricsPercentile(metrics.snapshot_wait_us[1], 95),
+             (unsigned long)metrics.snapshot_wait_us[1].max.load(std::memory_order_relaxed));
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+    snprintf(text, sizeof(text), "               retries: live %lu  vehicle info %lu",
+             (unsigned long)live_data.retryCount(),
+             (unsigned long)vehicle_info.retryCount());
+    drawStatsLine(y, COLOR_WHITE, text);
+}
+
+// ============================================================================
+// TASKS VIEW
+// ============================================================================
+
+/**
+ * Format one task column ("-" core = not pinned, "!" = stack below the warning level)
+ */
+inline void formatTaskColumn(char* out, size_t size, const TaskProfile& task, bool cpu_valid) {
+    char core = task.core < 0 ? '-' : (char)('0' + task.core);
+    if (cpu_valid) {
+        snprintf(out, size, "%-15s %c %2u %3u.%u %6lu%c", task.name, core, task.priority,
+                 task.cpu_x10 / 10, task.cpu_x10 % 10, (unsigned long)task.stack_free,
+                 task.stack_free < PROFILER_STACK_WARN_BYTES ? '!' : ' ');
+    } else {
+        snprintf(out, size, "%-15s %c %2u   n/a %6lu%c", task.name, core, task.priority,
+                 (unsigned long)task.stack_free,
+                 task.stack_free < PROFILER_STACK_WARN_BYTES ? '!' : ' ');
+    }
+}
+
+/**
+ * Draw the tasks view (all lines are rewritten on every call)
+ * Tasks fill two columns, busiest first; rows without a task are blanked
+ */
+inline void drawTaskStats() {
+    static ProfileSnapshot snap;  // Too large for the display task stack
+    getProfileSnapshot(snap);
+
+    char text[96];
+    int y = CONTENT_Y_START + 6;
+
+    snprintf(text, sizeof(text), "Tasks and Heap      %u tasks, sampled every %lu ms   (serial: '%c' for dump)",
+             snap.task_count, (unsigned long)PROFILER_SAMPLE_MS, METRICS_DUMP_KEY);
+    drawStatsLine(y, COLOR_CYAN, text);
+    y += STATS_LINE_HEIGHT + 4;
+
+    if (snap.cpu_valid) {
+        snprintf(text, sizeof(text), "CPU      core0 %u.%u%%   core1 %u.%u%%   (over %lu ms)",
+                 snap.core_load_x10[0] / 10, snap.core_load_x10[0] % 10,
+                 snap.core_load_x10[1] / 10, snap.core_load_x10[1] % 10,
+                 (unsigned long)snap.interval_ms);
+    } else {
+        snprintf(text, sizeof(text), "CPU      n/a (run-time stats disabled or first sample)");
+    }
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+
+    uint8_t heap_frag = profilerFragmentation(snap.heap_free, snap.heap_largest);
+    snprintf(text, sizeof(text), "Heap     free %lu KB  min %lu KB  largest %lu KB  frag %u%%",
+             (unsigned long)(snap.heap_free / 1024), (unsigned long)(snap.heap_min / 1024),
+             (unsigned long)(snap.heap_largest / 1024), heap_frag);
+    drawStatsLine(y, heap_frag >= 50 ? COLOR_YELLOW : COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+
+    snprintf(text, sizeof(text), "PSRAM    free %lu KB  min %lu KB  largest %lu KB  frag %u%%",
+             (unsigned long)(snap.psram_free / 1024), (unsigned long)(snap.psram_min / 1024),
+             (unsigned long)(snap.psram_largest / 1024),
+             profilerFragmentation(snap.psram_free, snap.psram_largest));
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT;
+
+    snprintf(text, sizeof(text), "Loop     idle wake late p95 %lu us  max %lu us  (%lu wakes)",
+             (unsigned long)snap.loop_late_p95_us, (unsigned long)snap.loop_late_max_us,
+             (unsigned long)snap.loop_wakes);
+    drawStatsLine(y, COLOR_WHITE, text);
+    y += STATS_LINE_HEIGHT + 4;
+
+    drawStatsLine(y, COLOR_GRAY, "Task            C Pr  CPU%  Stack      Task            C Pr  CPU%  Stack");
+    y += STATS_LINE_HEIGHT;
+
+    uint8_t rows = (STATS_CONTENT_END - y) / STATS_LINE_HEIGHT + 1;
+    for (uint8_t row = 0; row < rows; row++) {
+        char left[40] = "";
+        char right[40] = "";
+        bool low = false;
+
+        if (row < snap.task_count) {
+            formatTaskColumn(left, sizeof(left), snap.tasks[row], snap.cpu_valid);
+            low |= snap.tasks[row].stack_free < PROFILER_STACK_WARN_BYTES;
+        }
+        if (row + rows < snap.task_count) {
+            formatTaskColumn(right, sizeof(right), snap.tasks[row + rows], snap.cpu_valid);
+            low |= snap.tasks[row + rows].stack_free < PROFILER_STACK_WARN_BYTES;
+        }
+        snprintf(text, sizeof(text), "%-39s%s", left, right);
+        drawStatsLine(y, low ? COLOR_YELLOW : COLOR_WHITE, text);
+        y += STATS_LINE_HEIGHT;
+    }
+}
+
+/**
+ * Draw a stats page view
+ * @param view StatsView
+ */
+inline void drawStatsPage(uint8_t view) {
+    if (view == STATS_VIEW_TASKS) {
+        drawTaskStats();
+    } else {
+        drawLinkStats();
+    }
+}
+
+#endif // STATS_PAGE_H
@@ -16,7 +16,9 @@ enum Page {
     PAGE_DASHBOARD = 0,
     PAGE_DTC = 1,
     PAGE_CONFIG = 2,
-    PAGE_COUNT = 3
+    PAGE_STATS = 3,     // Hidden: SELECT on Config tab while on Config page
+    PAGE_GRAPH = 4,     // Hidden: SELECT on Dashboard tab past the last layout
+    PAGE_COUNT = 5
 };
 
 // ============================================================================
@@ -0,0 +1,130 @@
+/**
+ * Value Renderer - Flicker-free value cells
+ *
+ * Draws a changing value into an off-screen sprite and pushes only the
+ * dirty rectangle (old text extent + new text extent) in one window write:
+ * - No blank-then-redraw step (no flicker)
+ * - No fillRect + delay per value
+ * - Unchanged pixels outside the old/new text are never sent
+ *
+ * Value characters come from the anti-aliased digit atlas (digit_atlas.h),
+ * other text and small sizes from the GLCD font; text width is taken from
+ * the glyph metrics. Falls back to direct opaque GLCD text if the sprite
+ * cannot be allocated.
+ */
+
+#ifndef VALUE_RENDERER_H
+#define VALUE_RENDERER_H
+
+#include "ui_common.h"
+#include "dirty_rect.h"
+#include "display_writer.h"
+#include "digit_atlas.h"
+
+// GLCD font (font 1) glyph height at text size 1
+#define VALUE_GLYPH_HEIGHT  8
+
+/**
+ * Shared off-screen tile for value cells (one cell is rendered at a time)
+ */
+inline TFT_eSprite& getValueSprite() {
+    static TFT_eSprite sprite(&tft);
+    return sprite;
+}
+
+/**
+ * Make sure the value sprite can hold a w x h cell
+ * Grows the sprite if needed (reused for all smaller cells)
+ * @return true if sprite is available
+ */
+inline bool ensureValueSprite(int16_t w, int16_t h) {
+    TFT_eSprite& sprite = getValueSprite();
+
+    if (sprite.created() && sprite.width() >= w && sprite.height() >= h) {
+        return true;
+    }
+
+    if (sprite.created()) {
+        sprite.deleteSprite();
+    }
+
+    sprite.setColorDepth(16);
+    if (sprite.createSprite(w, h) == NULL) {
+        Serial.printf("[Display] Value sprite %dx%d allocation failed - using direct draw\n", w, h);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Draw value text centered in a cell, sending only the dirty pixels
+ * @param x Cell left edge (screen)
+ * @param y Cell top edge (screen)
+ * @param w Cell width
+ * @param h Cell height
+ * @param value Text to display
+ * @param text_size Text size (GLCD scale, also selects the digit atlas)
+ * @param color Text color (background is black)
+ * @param last_extent In: text extent drawn last time (cell coordinates, empty after a clear)
+ *                    Out: extent of the new text
+ */
+inline void drawValueCell(int16_t x, int16_t y, int16_t w, int16_t h, const char* value,
+                          uint8_t text_size, uint16_t color, DirtyRect& last_extent) {
+    // Measure new text from the glyph metrics (fixed height)
+    // Atlas glyphs need the sprite - direct text is always GLCD
+    bool sprite_ok = ensureValueSprite(w, h);
+    bool use_atlas = sprite_ok && digitTextCovered(value) && getDigitAtlas(text_size) != NULL;
+    int16_t text_w = use_atlas ? digitTextWidth(value, text_size)
+                               : (int16_t)(strlen(value) * METRIC_GLYPH_WIDTH * text_size);
+    int16_t text_x;
+    DirtyRect dirty = dirtyRectTextCell(w, h, text_w, (int16_t)(VALUE_GLYPH_HEIGHT * text_size),
+                                        last_extent, text_x);
+    const DirtyRect extent = last_extent;
+    if (dirtyRectEmpty(dirty)) return;
+
+    if (sprite_ok) {
+        TFT_eSprite& sprite = getValueSprite();
+        sprite.fillRect(dirty.x, dirty.y, dirty.w, dirty.h, COLOR_BLACK);
+        uint16_t* pixels = (uint16_t*)sprite.getPointer();
+        if (!use_atlas) {
+            sprite.setTextColor(color, COLOR_BLACK);
+            sprite.setTextSize(text_size);
+            sprite.setTextDatum(TL_DATUM);
+            sprite.drawString(value, text_x, 0);
+        } else {
+            drawDigitText(pixels, sprite.width(), sprite.height(), text_x, value, text_size, color);
+        }
+
+        // Single window write of the dirty region (background DMA if available)
+        if (displayPushDMA(x + dirty.x, y + dirty.y, dirty.w, dirty.h,
+                           pixels + dirty.y * sprite.width() + dirty.x, sprite.width())) {
+            return;
+        }
+        displayReservePixels((uint32_t)dirty.w * dirty.h);
+        sprite.pushSprite(x + dirty.x, y + dirty.y, dirty.x, dirty.y, dirty.w, dirty.h);
+        return;
+    }
+
+    // Fallback: opaque text overwrites its own cells, clear what is left of the old text
+    displayFlush();
+    displayReservePixels((uint32_t)extent.w * extent.h);
+    tft.setTextColor(color, COLOR_BLACK);
+    tft.setTextSize(text_size);
+    tft.setTextDatum(TL_DATUM);
+    tft.drawString(value, x + text_x, y);
+
+    if (dirtyRectEmpty(extent)) {
+        displayFillRect(x + dirty.x, y + dirty.y, dirty.w, dirty.h, COLOR_BLACK);
+        return;
+    }
+    if (dirty.x < extent.x) {
+        displayFillRect(x + dirty.x, y + dirty.y, extent.x - dirty.x, dirty.h, COLOR_BLACK);
+    }
+    int16_t dirty_right = dirty.x + dirty.w;
+    int16_t extent_right = extent.x + extent.w;
+    if (dirty_right > extent_right) {
+        displayFillRect(x + extent_right, y + dirty.y, dirty_right - extent_right, dirty.h, COLOR_BLACK);
+    }
+}
+
+#endif // VALUE_RENDERER_H
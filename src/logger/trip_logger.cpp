@@ -0,0 +1,345 @@
+/**
+ * Trip Logger Module - Implementation
+ */
+
+#include "trip_logger.h"
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <atomic>
+#include "../obd2/elm_parser.h"
+
+static_assert((TRIP_LOG_RING_BYTES & (TRIP_LOG_RING_BYTES - 1)) == 0,
+              "TRIP_LOG_RING_BYTES must be a power of two");
+static_assert(TRIP_LOG_BLOCK_BYTES <= TRIP_LOG_RING_BYTES,
+              "A flush block must fit into the ring buffer");
+
+// ============================================================================
+// RING BUFFER (single producer: OBD2 task, single consumer: writer task)
+// ============================================================================
+
+static uint8_t* ring = NULL;                    // TRIP_LOG_RING_BYTES encoded records
+static std::atomic<uint32_t> ring_head(0);      // Next byte to fill (producer)
+static std::atomic<uint32_t> ring_tail(0);      // Next byte to flush (consumer)
+static std::atomic<bool> log_active(false);     // Cleared on storage failure
+
+// Producer-side delta chain (OBD2 task only)
+static uint32_t last_record_ms = 0;
+static bool time_marker_needed = true;
+
+// Slow PIDs: last value written (OBD2 task only)
+static const uint8_t change_only_pids[] = TRIP_LOG_CHANGE_ONLY_PIDS;
+
+#define TRIP_CHANGE_ONLY_COUNT  (sizeof(change_only_pids) / sizeof(change_only_pids[0]))
+
+static uint16_t change_only_value[TRIP_CHANGE_ONLY_COUNT];
+static bool change_only_known[TRIP_CHANGE_ONLY_COUNT];
+
+// Counters
+static std::atomic<uint32_t> records_queued(0);
+static std::atomic<uint32_t> records_dropped(0);
+static std::atomic<uint32_t> bytes_written(0);
+
+uint8_t tripPayloadBytes(uint8_t pid) {
+    return getPIDDataLength(pid) >= 2 ? 2 : 1;
+}
+
+/**
+ * Append one encoded record to the ring (never blocks, all or nothing)
+ * @return false if the ring is full (record dropped)
+ */
+static bool pushRecord(const uint8_t* bytes, uint32_t len) {
+    uint32_t head = ring_head.load(std::memory_order_relaxed);
+    uint32_t tail = ring_tail.load(std::memory_order_acquire);
+
+    if (TRIP_LOG_RING_BYTES - (head - tail) < len) {
+        records_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < len; i++) {
+        ring[(head + i) & (TRIP_LOG_RING_BYTES - 1)] = bytes[i];
+    }
+    ring_head.store(head + len, std::memory_order_release);
+    records_queued.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Slot of a change-only PID
+ * @return -1 if the PID is written on every sample
+ */
+static int changeOnlySlot(uint8_t pid) {
+    for (uint8_t i = 0; i < TRIP_CHANGE_ONLY_COUNT; i++) {
+        if (change_only_pids[i] == pid) return i;
+    }
+    return -1;
+}
+
+void tripLogSample(uint8_t pid, const uint8_t* data, uint8_t len, uint32_t now_ms) {
+    if (!log_active.load(std::memory_order_relaxed)) return;
+
+    uint8_t width = tripPayloadBytes(pid);
+    uint8_t payload[2] = {0, 0};
+    for (uint8_t i = 0; i < width && i < len; i++) {
+        payload[i] = data[i];
+    }
+
+    // Slow PIDs: skip repeats of the value already in the file
+    int slot = changeOnlySlot(pid);
+    uint16_t value = payload[0] | (payload[1] << 8);
+    if (slot >= 0 && change_only_known[slot] && change_only_value[slot] == value) return;
+
+    uint8_t record[TRIP_RECORD_MAX_BYTES];
+    uint32_t len_out = 0;
+    uint32_t delta = now_ms - last_record_ms;
+    if (time_marker_needed || delta >= TRIP_DELTA_ESCAPE) {
+        record[len_out++] = TRIP_DELTA_ESCAPE;
+        record[len_out++] = now_ms & 0xFF;
+        record[len_out++] = (now_ms >> 8) & 0xFF;
+        record[len_out++] = (now_ms >> 16) & 0xFF;
+        record[len_out++] = (now_ms >> 24) & 0xFF;
+    } else {
+        record[len_out++] = (uint8_t)delta;
+    }
+    record[len_out++] = pid;
+    for (uint8_t i = 0; i < width; i++) {
+        record[len_out++] = payload[i];
+    }
+
+    // Dropped records leave the chain at the last record written
+    if (!pushRecord(record, len_out)) return;
+
+    last_record_ms = now_ms;
+    time_marker_needed = false;
+    if (slot >= 0) {
+        change_only_value[slot] = value;
+        change_only_known[slot] = true;
+    }
+}
+
+void tripLogEvent(TripEvent event, uint32_t now_ms) {
+    uint8_t data = event;
+    tripLogSample(TRIP_PID_EVENT, &data, 1, now_ms);
+
+    // Each session starts with the current slow values
+    for (uint8_t i = 0; i < TRIP_CHANGE_ONLY_COUNT; i++) {
+        change_only_known[i] = false;
+    }
+}
+
+void getTripLogStats(uint32_t& queued, uint32_t& dropped, uint32_t& written) {
+    queued = records_queued.load(std::memory_order_relaxed);
+    dropped = records_dropped.load(std::memory_order_relaxed);
+    written = bytes_written.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// STORAGE (writer task only)
+// ============================================================================
+
+static File trip_file;
+static uint16_t trip_number = 0;
+static uint8_t block[TRIP_LOG_BLOCK_BYTES];  // Staging for one sequential write
+
+/**
+ * Parse trip number from a file name ("trip_0001.bin" or "/trips/trip_0001.bin")
+ * @return Trip number, or -1 if not a trip file
+ */
+static int parseTripNumber(const char* name) {
+    const char* base = strrchr(name, '/');
+    base = base ? base + 1 : name;
+
+    unsigned int number;
+    if (sscanf(base, "trip_%u.bin", &number) != 1) return -1;
+    return (int)number;
+}
+
+/**
+ * Find lowest and highest trip numbers in TRIP_LOG_DIR
+ * @return Number of trip files found
+ */
+static int scanTrips(int& oldest, int& newest) {
+    oldest = -1;
+    newest = -1;
+    int count = 0;
+
+    File dir = LittleFS.open(TRIP_LOG_DIR);
+    if (!dir || !dir.isDirectory()) return 0;
+
+    File entry = dir.openNextFile();
+    while (entry) {
+        int number = parseTripNumber(entry.name());
+        if (number >= 0) {
+            if (oldest < 0 || number < oldest) oldest = number;
+            if (newest < 0 || number > newest) newest = number;
+            count++;
+        }
+        entry.close();
+        entry = dir.openNextFile();
+    }
+    dir.close();
+    return count;
+}
+
+static void tripPath(char* path, size_t size, int number) {
+    snprintf(path, size, "%s/trip_%04d.bin", TRIP_LOG_DIR, number);
+}
+
+/**
+ * Delete oldest trips until TRIP_LOG_MIN_FREE_BYTES are free
+ * @return false if only the current trip is left and space is still short
+ */
+static bool ensureFreeSpace() {
+    while (LittleFS.totalBytes() - LittleFS.usedBytes() < TRIP_LOG_MIN_FREE_BYTES) {
+        int oldest, newest;
+        scanTrips(oldest, newest);
+        if (oldest < 0 || oldest == trip_number) {
+            return false;
+        }
+
+        char path[32];
+        tripPath(path, sizeof(path), oldest);
+        Serial.printf("[TripLog] Storage low - deleting %s\n", path);
+        LittleFS.remove(path);
+    }
+    return true;
+}
+
+/**
+ * Create the file for this boot and write its header
+ */
+static bool openTripFile() {
+    if (!LittleFS.exists(TRIP_LOG_DIR)) {
+        LittleFS.mkdir(TRIP_LOG_DIR);
+    }
+
+    int oldest, newest;
+    scanTrips(oldest, newest);
+    trip_number = (newest < 0 || newest >= 9999) ? 1 : newest + 1;
+
+    if (!ensureFreeSpace()) {
+        Serial.println("[TripLog] Not enough flash space");
+        return false;
+    }
+
+    char path[32];
+    tripPath(path, sizeof(path), trip_number);
+    trip_file = LittleFS.open(path, FILE_WRITE);
+    if (!trip_file) {
+        Serial.printf("[TripLog] Failed to create %s\n", path);
+        return false;
+    }
+
+    TripFileHeader header;
+    memcpy(header.magic, TRIP_LOG_MAGIC, sizeof(header.magic));
+    header.version = TRIP_LOG_VERSION;
+    header.header_size = sizeof(TripFileHeader);
+    header.trip_number = trip_number;
+    header.start_ms = millis();
+    memset(header.wide_pids, 0, sizeof(header.wide_pids));
+    for (int pid = 0; pid < 256; pid++) {
+        if (tripPayloadBytes(pid) == 2) header.wide_pids[pid >> 3] |= 1 << (pid & 7);
+    }
+    trip_file.write((const uint8_t*)&header, sizeof(header));
+    trip_file.flush();
+
+    Serial.printf("[TripLog] Logging to %s\n", path);
+    return true;
+}
+
+/**
+ * Move up to one block of bytes from the ring to flash
+ * (records may span two blocks - the file is one byte stream)
+ */
+static void flushBlock(uint32_t count) {
+    uint32_t tail = ring_tail.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; i++) {
+        block[i] = ring[(tail + i) & (TRIP_LOG_RING_BYTES - 1)];
+    }
+    // Slots are free again as soon as they are copied
+    ring_tail.store(tail + count, std::memory_order_release);
+
+    if (!ensureFreeSpace()) {
+        Serial.println("[TripLog] Flash full - logging stopped");
+        log_active.store(false);
+        trip_file.close();
+        return;
+    }
+
+    size_t bytes = count;
+    size_t written = trip_file.write(block, bytes);
+    trip_file.flush();  // Commit block (at most one block lost on power cut)
+    bytes_written.fetch_add(written, std::memory_order_relaxed);
+
+    if (written != bytes) {
+        Serial.println("[TripLog] Write failed - logging stopped");
+        log_active.store(false);
+        trip_file.close();
+    }
+}
+
+/**
+ * Writer task - sleeps until a full block is queued or the flush interval passed
+ */
+static void tripLogTask(void* parameter) {
+    uint32_t last_flush = millis();
+
+    while (log_active.load()) {
+        uint32_t pending = ring_head.load(std::memory_order_acquire) -
+                           ring_tail.load(std::memory_order_relaxed);
+        bool interval_due = pending > 0 && millis() - last_flush >= TRIP_LOG_FLUSH_MS;
+
+        if (pending >= TRIP_LOG_BLOCK_BYTES || interval_due) {
+            flushBlock(pending < TRIP_LOG_BLOCK_BYTES ? pending : TRIP_LOG_BLOCK_BYTES);
+            last_flush = millis();
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(TRIP_LOG_POLL_MS));
+        }
+    }
+
+    vTaskDelete(NULL);
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void startTripLogger() {
+    if (!TRIP_LOG_ENABLED) return;
+
+    // Ring in PSRAM if available, internal RAM otherwise
+    ring = (uint8_t*)heap_caps_malloc(TRIP_LOG_RING_BYTES, MALLOC_CAP_SPIRAM);
+    if (ring == NULL) {
+        ring = (uint8_t*)heap_caps_malloc(TRIP_LOG_RING_BYTES, MALLOC_CAP_8BIT);
+    }
+    if (ring == NULL) {
+        Serial.println("[TripLog] Ring buffer allocation failed - logging disabled");
+        return;
+    }
+
+    if (!LittleFS.begin(true)) {
+        Serial.println("[TripLog] LittleFS mount failed - logging disabled");
+        return;
+    }
+    Serial.printf("[TripLog] LittleFS: %u / %u bytes used\n",
+                  (unsigned)LittleFS.usedBytes(), (unsigned)LittleFS.totalBytes());
+
+    if (!openTripFile()) {
+        return;
+    }
+
+    log_active.store(true);
+
+    xTaskCreatePinnedToCore(
+        tripLogTask,                 // Task function
+        "TripLogTask",               // Task name
+        TRIP_LOG_TASK_STACK_SIZE,    // Stack size
+        NULL,                        // Parameters
+        TRIP_LOG_TASK_PRIORITY,      // Priority
+        NULL,                        // Task handle
+        TRIP_LOG_TASK_CORE           // Core
+    );
+
+    Serial.printf("✓ Trip logger started (%d byte ring, %d byte blocks)\n",
+                  TRIP_LOG_RING_BYTES, TRIP_LOG_BLOCK_BYTES);
+}
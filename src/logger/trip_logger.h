@@ -0,0 +1,98 @@
+/**
+ * Trip Logger Module
+ *
+ * Records decoded PID samples for later analysis:
+ * - Variable-length binary records of 3-4 bytes (delta-ms, PID, raw data bytes)
+ * - PIDs in TRIP_LOG_CHANGE_ONLY_PIDS are written only when their value changed
+ * - Lock-free single-producer byte ring filled by the OBD2 task (never blocks;
+ *   records are dropped and counted if the ring is full)
+ * - Low-priority writer task flushes whole blocks to LittleFS
+ * - One file per boot (/trips/trip_NNNN.bin), oldest trips deleted when space runs low
+ *
+ * File layout (little endian):
+ *   TripFileHeader, then a stream of records:
+ *     uint8 delta       ms since the previous record (0-254)
+ *     [uint32 time_ms]  only if delta = TRIP_DELTA_ESCAPE: absolute time (ms since boot)
+ *     uint8 pid         Mode 01 PID or TRIP_PID_EVENT
+ *     uint8 data[1|2]   Raw ECU bytes; 2 if the PID's bit is set in
+ *                       TripFileHeader.wide_pids, else 1
+ *   The escape is written for the first record and for gaps of 255 ms or more.
+ *   A change-only PID keeps its last value until its next record.
+ */
+
+#ifndef TRIP_LOGGER_H
+#define TRIP_LOGGER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// RECORD FORMAT
+// ============================================================================
+
+#define TRIP_LOG_MAGIC          "OBDT"
+#define TRIP_LOG_VERSION        2
+
+#define TRIP_DELTA_ESCAPE       0xFF   // Delta byte: absolute time follows
+#define TRIP_RECORD_MAX_BYTES   8      // Escape + time + PID + 2 data bytes
+
+// Special record id (not a Mode 01 PID we poll)
+#define TRIP_PID_EVENT          0xFE   // data[0] = TripEvent
+
+enum TripEvent : uint8_t {
+    TRIP_EVENT_DISCONNECTED = 0,
+    TRIP_EVENT_CONNECTED = 1
+};
+
+/**
+ * File header (44 bytes)
+ */
+struct TripFileHeader {
+    char magic[4];          // "OBDT"
+    uint8_t version;        // TRIP_LOG_VERSION
+    uint8_t header_size;    // sizeof(TripFileHeader)
+    uint16_t trip_number;   // Same as file name
+    uint32_t start_ms;      // millis() when the file was created
+    uint8_t wide_pids[32];  // Bit per record id (pid >> 3, 1 << (pid & 7)): 2 data bytes
+};
+
+static_assert(sizeof(TripFileHeader) == 44, "TripFileHeader must stay 44 bytes (file format)");
+
+/**
+ * Data bytes stored for a record id (Mode 01 length, at most 2; events 1)
+ */
+uint8_t tripPayloadBytes(uint8_t pid);
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Mount LittleFS, open a new trip file and start the writer task
+ * Logging stays disabled (all record calls are no-ops) if anything fails
+ */
+void startTripLogger();
+
+/**
+ * Queue one PID sample (OBD2 task only, never blocks)
+ * @param pid Mode 01 PID
+ * @param data Raw data bytes
+ * @param len Number of data bytes (tripPayloadBytes() are stored)
+ * @param now_ms Sample time (millis)
+ */
+void tripLogSample(uint8_t pid, const uint8_t* data, uint8_t len, uint32_t now_ms);
+
+/**
+ * Queue an event record (OBD2 task only, never blocks)
+ */
+void tripLogEvent(TripEvent event, uint32_t now_ms);
+
+/**
+ * Get logger counters (any task)
+ * @param queued Records accepted into the ring
+ * @param dropped Records dropped because the ring was full
+ * @param written Bytes written to flash
+ */
+void getTripLogStats(uint32_t& queued, uint32_t& dropped, uint32_t& written);
+
+#endif // TRIP_LOGGER_H
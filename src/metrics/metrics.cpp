@@ -0,0 +1,236 @@
+/**
+ * Metrics Module - Implementation
+ */
+
+#include "metrics.h"
+#include "profiler.h"
+#include "../obd2/obd_data.h"
+
+// ============================================================================
+// GLOBAL OBJECTS
+// ============================================================================
+
+Metrics metrics;  // Static storage: all counters start at zero
+
+// ============================================================================
+// HISTOGRAMS
+// ============================================================================
+
+/**
+ * Bucket index for a value (bit length, capped at last bucket)
+ */
+static uint8_t bucketIndex(uint32_t value) {
+    uint8_t index = 0;
+    while (value != 0 && index < METRICS_HISTOGRAM_BUCKETS - 1) {
+        value >>= 1;
+        index++;
+    }
+    return index;
+}
+
+void metricsRecord(MetricHistogram& hist, uint32_t value) {
+    hist.buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    hist.count.fetch_add(1, std::memory_order_relaxed);
+
+    uint32_t current = hist.max.load(std::memory_order_relaxed);
+    while (value > current &&
+           !hist.max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint32_t metricsPercentile(const MetricHistogram& hist, uint8_t percent) {
+    uint32_t count = hist.count.load(std::memory_order_relaxed);
+    if (count == 0) return 0;
+
+    uint32_t target = (count * percent + 99) / 100;
+    uint32_t max = hist.max.load(std::memory_order_relaxed);
+    uint32_t seen = 0;
+
+    for (uint8_t i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+        seen += hist.buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            uint32_t upper = (i == 0) ? 0 : (1UL << i) - 1;
+            return (i == METRICS_HISTOGRAM_BUCKETS - 1 || upper > max) ? max : upper;
+        }
+    }
+    return max;
+}
+
+// ============================================================================
+// RATES
+// ============================================================================
+
+void metricsRecordEvent(MetricRate& rate, uint32_t now_ms) {
+    rate.total.fetch_add(1, std::memory_order_relaxed);
+    rate.last_event_ms.store(now_ms, std::memory_order_relaxed);
+    rate.window_events++;
+
+    uint32_t elapsed = now_ms - rate.window_start_ms;
+    if (elapsed >= METRICS_RATE_WINDOW_MS) {
+        rate.hz_x10.store(rate.window_events * 10000 / elapsed, std::memory_order_relaxed);
+        rate.window_start_ms = now_ms;
+        rate.window_events = 0;
+    }
+}
+
+uint32_t metricsRateHzX10(const MetricRate& rate, uint32_t now_ms) {
+    if (rate.total.load(std::memory_order_relaxed) == 0) return 0;
+    if (now_ms - rate.last_event_ms.load(std::memory_order_relaxed) > 2 * METRICS_RATE_WINDOW_MS) {
+        return 0;  // Signal stopped updating
+    }
+    return rate.hz_x10.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// OBD2 METRICS
+// ============================================================================
+
+MetricPID metricsPIDSlot(uint8_t pid) {
+    switch (pid) {
+        case PID_RPM:             return METRIC_PID_RPM;
+        case PID_SPEED:           return METRIC_PID_SPEED;
+        case PID_THROTTLE:        return METRIC_PID_THROTTLE;
+        case PID_COOLANT_TEMP:    return METRIC_PID_COOLANT;
+        case PID_INTAKE_TEMP:     return METRIC_PID_INTAKE;
+        case PID_BATTERY_VOLTAGE: return METRIC_PID_BATTERY;
+        case PID_MAF:             return METRIC_PID_MAF;
+        case PID_MAP:             return METRIC_PID_MAP;
+        case PID_ENGINE_LOAD:     return METRIC_PID_LOAD;
+        case PID_BARO:            return METRIC_PID_BARO;
+        default:                  return METRIC_PID_COUNT;
+    }
+}
+
+const char* metricsPIDName(uint8_t slot) {
+    switch (slot) {
+        case METRIC_PID_RPM:      return "RPM";
+        case METRIC_PID_SPEED:    return "Speed";
+        case METRIC_PID_THROTTLE: return "Throttle";
+        case METRIC_PID_COOLANT:  return "Coolant";
+        case METRIC_PID_INTAKE:   return "Intake";
+        case METRIC_PID_BATTERY:  return "Battery";
+        case METRIC_PID_MAF:      return "MAF";
+        case METRIC_PID_MAP:      return "MAP";
+        case METRIC_PID_LOAD:     return "Load";
+        case METRIC_PID_BARO:     return "Baro";
+        default:                  return "?";
+    }
+}
+
+void metricsRecordPID(uint8_t pid, uint32_t rtt_ms, bool success) {
+    MetricPID slot = metricsPIDSlot(pid);
+    if (slot == METRIC_PID_COUNT) return;
+
+    PIDMetrics& m = metrics.pids[slot];
+    if (success) {
+        metricsRecord(m.rtt_ms, rtt_ms);
+        metricsRecordEvent(m.updates, millis());
+    } else {
+        m.failures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void metricsRecordCommand(ELMStatus status, uint32_t rtt_ms) {
+    ELMMetrics& m = metrics.elm;
+    metricsRecord(m.rtt_ms, rtt_ms);
+
+    switch (status) {
+        case ELM_OK:       m.ok.fetch_add(1, std::memory_order_relaxed); break;
+        case ELM_NO_DATA:  m.no_data.fetch_add(1, std::memory_order_relaxed); break;
+        case ELM_TIMEOUT:  m.timeouts.fetch_add(1, std::memory_order_relaxed); break;
+        case ELM_OVERFLOW: m.overflows.fetch_add(1, std::memory_order_relaxed); break;
+        default:           m.errors.fetch_add(1, std::memory_order_relaxed); break;
+    }
+}
+
+// ============================================================================
+// DISPLAY METRICS
+// ============================================================================
+
+void metricsRecordFrame(uint32_t total_us, uint32_t fill_us, uint32_t wait_us) {
+    DisplayMetrics& m = metrics.display;
+    uint32_t now = millis();
+
+    metricsRecord(m.frame_us, total_us);
+
+    // Text/other = whatever is not a fill or a wait
+    uint32_t accounted = fill_us + wait_us;
+    m.window_fill_us += fill_us;
+    m.window_wait_us += wait_us;
+    m.window_text_us += (total_us > accounted) ? total_us - accounted : 0;
+    m.window_frames++;
+
+    // Publish per-frame averages when the rate window rolls over
+    uint32_t window_start = m.frames.window_start_ms;
+    metricsRecordEvent(m.frames, now);
+    if (m.frames.window_start_ms != window_start) {
+        m.avg_fill_us.store(m.window_fill_us / m.window_frames, std::memory_order_relaxed);
+        m.avg_text_us.store(m.window_text_us / m.window_frames, std::memory_order_relaxed);
+        m.avg_wait_us.store(m.window_wait_us / m.window_frames, std::memory_order_relaxed);
+        m.window_fill_us = 0;
+        m.window_text_us = 0;
+        m.window_wait_us = 0;
+        m.window_frames = 0;
+    }
+}
+
+// ============================================================================
+// SERIAL DUMP
+// ============================================================================
+
+static void dumpHistogram(const char* name, const MetricHistogram& hist, const char* unit) {
+    Serial.printf("  %-14s n=%-7lu p50=%-6lu p95=%-6lu p99=%-6lu max=%lu %s\n", name,
+                  (unsigned long)hist.count.load(std::memory_order_relaxed),
+                  (unsigned long)metricsPercentile(hist, 50),
+                  (unsigned long)metricsPercentile(hist, 95),
+                  (unsigned long)metricsPercentile(hist, 99),
+                  (unsigned long)hist.max.load(std::memory_order_relaxed), unit);
+}
+
+void metricsDump() {
+    uint32_t now = millis();
+
+    Serial.println("\n========== METRICS ==========");
+    Serial.printf("Uptime: %lu s\n", (unsigned long)(now / 1000));
+
+    Serial.println("[PIDs] round-trip (ms), achieved rate, failures");
+    for (uint8_t i = 0; i < METRIC_PID_COUNT; i++) {
+        const PIDMetrics& m = metrics.pids[i];
+        uint32_t hz_x10 = metricsRateHzX10(m.updates, now);
+        dumpHistogram(metricsPIDName(i), m.rtt_ms, "ms");
+        Serial.printf("  %-14s %lu.%lu Hz, %lu updates, %lu failures\n", "",
+                      (unsigned long)(hz_x10 / 10), (unsigned long)(hz_x10 % 10),
+                      (unsigned long)m.updates.total.load(std::memory_order_relaxed),
+                      (unsigned long)m.failures.load(std::memory_order_relaxed));
+    }
+
+    const ELMMetrics& elm = metrics.elm;
+    Serial.println("[ELM327] commands");
+    dumpHistogram("Round-trip", elm.rtt_ms, "ms");
+    Serial.printf("  OK=%lu NO DATA=%lu errors=%lu timeouts=%lu overflows=%lu\n",
+                  (unsigned long)elm.ok.load(std::memory_order_relaxed),
+                  (unsigned long)elm.no_data.load(std::memory_order_relaxed),
+                  (unsigned long)elm.errors.load(std::memory_order_relaxed),
+                  (unsigned long)elm.timeouts.load(std::memory_order_relaxed),
+                  (unsigned long)elm.overflows.load(std::memory_order_relaxed));
+
+    const DisplayMetrics& d = metrics.display;
+    uint32_t fps_x10 = metricsRateHzX10(d.frames, now);
+    Serial.println("[Display] frames");
+    dumpHistogram("Frame", d.frame_us, "us");
+    Serial.printf("  %lu.%lu fps, per frame: fill=%lu us text=%lu us wait=%lu us\n",
+                  (unsigned long)(fps_x10 / 10), (unsigned long)(fps_x10 % 10),
+                  (unsigned long)d.avg_fill_us.load(std::memory_order_relaxed),
+                  (unsigned long)d.avg_text_us.load(std::memory_order_relaxed),
+                  (unsigned long)d.avg_wait_us.load(std::memory_order_relaxed));
+
+    Serial.println("[Snapshots] SeqLock read time (us), retries");
+    dumpHistogram("Core 0", metrics.snapshot_wait_us[0], "us");
+    dumpHistogram("Core 1", metrics.snapshot_wait_us[1], "us");
+    Serial.printf("  live_data retries=%lu, vehicle_info retries=%lu\n",
+                  (unsigned long)live_data.retryCount(),
+                  (unsigned long)vehicle_info.retryCount());
+
+    profilerDump();
+    Serial.println("=============================\n");
+}
@@ -0,0 +1,185 @@
+/**
+ * Metrics Module
+ *
+ * Lightweight runtime instrumentation for tuning:
+ * - Fixed-size log2 histograms (no allocation, O(1) record)
+ * - Per-PID round-trip time, failures and achieved update rate
+ * - ELM327 reply status counters (OK, NO DATA, errors, timeouts, overflows)
+ * - Display frame time split into fill / text / wait
+ * - Snapshot (SeqLock) read time on both cores
+ *
+ * Counters are relaxed atomics: each field is exact, a dump may mix values
+ * from neighbouring updates. Viewable on the hidden stats page
+ * (SELECT on Config while on the Config page) or dumped over serial
+ * by sending METRICS_DUMP_KEY.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "../obd2/seqlock.h"
+#include "../obd2/elm_parser.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * Log2 histogram
+ * Bucket 0 holds 0, bucket i holds [2^(i-1), 2^i), last bucket is open-ended
+ */
+struct MetricHistogram {
+    std::atomic<uint32_t> buckets[METRICS_HISTOGRAM_BUCKETS];
+    std::atomic<uint32_t> count;    // Samples recorded
+    std::atomic<uint32_t> max;      // Largest sample
+};
+
+/**
+ * Event rate over METRICS_RATE_WINDOW_MS windows
+ * Window state is writer-only, results are atomics
+ */
+struct MetricRate {
+    uint32_t window_start_ms;             // Writer only
+    uint32_t window_events;               // Writer only
+    std::atomic<uint32_t> hz_x10;         // Rate of last complete window (0.1 Hz units)
+    std::atomic<uint32_t> last_event_ms;  // Time of last event
+    std::atomic<uint32_t> total;          // Events since boot
+};
+
+// Live PIDs tracked per signal (order of the stats page)
+enum MetricPID : uint8_t {
+    METRIC_PID_RPM = 0,
+    METRIC_PID_SPEED,
+    METRIC_PID_THROTTLE,
+    METRIC_PID_COOLANT,
+    METRIC_PID_INTAKE,
+    METRIC_PID_BATTERY,
+    METRIC_PID_MAF,
+    METRIC_PID_MAP,
+    METRIC_PID_LOAD,
+    METRIC_PID_BARO,
+    METRIC_PID_COUNT
+};
+
+struct PIDMetrics {
+    MetricHistogram rtt_ms;           // Request -> reply time for requests answering this PID
+    MetricRate updates;               // Successful updates (achieved Hz)
+    std::atomic<uint32_t> failures;   // Requests without a value for this PID
+};
+
+struct ELMMetrics {
+    MetricHistogram rtt_ms;           // Every command (PIDs, DTCs, VIN)
+    std::atomic<uint32_t> ok;
+    std::atomic<uint32_t> no_data;
+    std::atomic<uint32_t> errors;
+    std::atomic<uint32_t> timeouts;
+    std::atomic<uint32_t> overflows;
+};
+
+struct DisplayMetrics {
+    MetricHistogram frame_us;         // Whole drawCurrentPage() call
+    MetricRate frames;                // Achieved frame rate
+    std::atomic<uint32_t> avg_fill_us;    // Per frame, last window: paced fills
+    std::atomic<uint32_t> avg_text_us;    // Per frame, last window: everything else (text, lines, sprites)
+    std::atomic<uint32_t> avg_wait_us;    // Per frame, last window: pixel budget and DMA waits
+    uint32_t window_fill_us;          // Writer only
+    uint32_t window_text_us;          // Writer only
+    uint32_t window_wait_us;          // Writer only
+    uint32_t window_frames;           // Writer only
+};
+
+struct Metrics {
+    PIDMetrics pids[METRIC_PID_COUNT];
+    ELMMetrics elm;
+    DisplayMetrics display;
+    MetricHistogram snapshot_wait_us[2];  // SeqLock read time per core
+};
+
+// ============================================================================
+// GLOBAL OBJECTS (declared here, defined in metrics.cpp)
+// ============================================================================
+
+extern Metrics metrics;
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Add one sample to a histogram (safe from any task)
+ */
+void metricsRecord(MetricHistogram& hist, uint32_t value);
+
+/**
+ * Estimate a percentile from histogram buckets
+ * @param percent 1-100
+ * @return Upper edge of the bucket holding the percentile (capped at max), 0 if empty
+ */
+uint32_t metricsPercentile(const MetricHistogram& hist, uint8_t percent);
+
+/**
+ * Count one event for a rate (single writer per rate)
+ */
+void metricsRecordEvent(MetricRate& rate, uint32_t now_ms);
+
+/**
+ * Get achieved rate (0 if no event in the last two windows)
+ * @return Rate in 0.1 Hz units
+ */
+uint32_t metricsRateHzX10(const MetricRate& rate, uint32_t now_ms);
+
+/**
+ * Map Mode 01 PID to its metrics slot
+ * @return Slot, or METRIC_PID_COUNT if the PID is not tracked
+ */
+MetricPID metricsPIDSlot(uint8_t pid);
+
+/**
+ * Short signal name for a slot (e.g., "RPM")
+ */
+const char* metricsPIDName(uint8_t slot);
+
+/**
+ * Record result of a request for one PID (OBD2 task only)
+ * @param pid Mode 01 PID
+ * @param rtt_ms Round-trip time of the request that carried the PID
+ * @param success Whether a value was decoded
+ */
+void metricsRecordPID(uint8_t pid, uint32_t rtt_ms, bool success);
+
+/**
+ * Record one ELM327 command (OBD2 task only)
+ * @param status Reply status
+ * @param rtt_ms Time from send to prompt (or timeout)
+ */
+void metricsRecordCommand(ELMStatus status, uint32_t rtt_ms);
+
+/**
+ * Record one display frame (display task only)
+ * @param total_us Whole frame
+ * @param fill_us Time in paced fills (without budget waits)
+ * @param wait_us Time waiting for pixel budget / DMA
+ */
+void metricsRecordFrame(uint32_t total_us, uint32_t fill_us, uint32_t wait_us);
+
+/**
+ * Copy a SeqLock snapshot and record how long the read took on this core
+ * @return Version of the snapshot
+ */
+template <typename T>
+inline uint32_t metricsTimedRead(const SeqLock<T>& lock, T& out) {
+    uint32_t start = micros();
+    uint32_t version = lock.read(out);
+    metricsRecord(metrics.snapshot_wait_us[xPortGetCoreID() & 1], micros() - start);
+    return version;
+}
+
+/**
+ * Print all metrics to Serial
+ */
+void metricsDump();
+
+#endif // METRICS_H
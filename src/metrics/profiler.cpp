@@ -0,0 +1,258 @@
+/**
+ * Profiler Module - Implementation
+ */
+
+#include "profiler.h"
+#include <esp_heap_caps.h>
+#include "metrics.h"
+#include "../obd2/seqlock.h"
+
+// Task CPU shares need the run-time counters (sdkconfig); stacks and heap work without
+#if configGENERATE_RUN_TIME_STATS
+#define PROFILER_RUN_TIME_STATS  true
+#else
+#define PROFILER_RUN_TIME_STATS  false
+#endif
+
+// ============================================================================
+// STATE (input loop only, snapshot readable from any task)
+// ============================================================================
+
+static SeqLock<ProfileSnapshot> profile_snapshot;
+static ProfileSnapshot sample;              // Built here, then published
+static MetricHistogram loop_late_us;        // Static storage: starts at zero
+
+#if configUSE_TRACE_FACILITY
+static TaskStatus_t task_status[PROFILER_MAX_TASKS];
+#endif
+
+// Run-time counters of the previous sample (CPU share = counter delta / interval)
+static TaskHandle_t prev_handles[PROFILER_MAX_TASKS];
+static uint32_t prev_runtime[PROFILER_MAX_TASKS];
+static uint8_t prev_count = 0;
+static uint32_t prev_total = 0;
+
+static uint32_t last_sample_ms = 0;
+static uint32_t last_log_ms = 0;
+static bool has_sample = false;
+static bool overflow_reported = false;
+
+// ============================================================================
+// SAMPLING
+// ============================================================================
+
+/**
+ * Run-time counter of a task at the previous sample
+ * @return 0 for a task created since then (all its time is in this interval)
+ */
+static uint32_t previousRunTime(TaskHandle_t handle) {
+    for (uint8_t i = 0; i < prev_count; i++) {
+        if (prev_handles[i] == handle) return prev_runtime[i];
+    }
+    return 0;
+}
+
+/**
+ * Busiest first, equal shares by least stack headroom
+ */
+static bool busierThan(const TaskProfile& a, const TaskProfile& b) {
+    if (a.cpu_x10 != b.cpu_x10) return a.cpu_x10 > b.cpu_x10;
+    return a.stack_free < b.stack_free;
+}
+
+static void sortTasks(ProfileSnapshot& snap) {
+    for (uint8_t i = 1; i < snap.task_count; i++) {
+        TaskProfile task = snap.tasks[i];
+        uint8_t j = i;
+        while (j > 0 && busierThan(task, snap.tasks[j - 1])) {
+            snap.tasks[j] = snap.tasks[j - 1];
+            j--;
+        }
+        snap.tasks[j] = task;
+    }
+}
+
+/**
+ * Fill the task table and the core loads
+ */
+static void sampleTasks(ProfileSnapshot& snap) {
+    snap.task_count = 0;
+    snap.cpu_valid = false;
+    snap.core_load_x10[0] = 0;
+    snap.core_load_x10[1] = 0;
+
+#if configUSE_TRACE_FACILITY
+    uint32_t total = 0;
+    UBaseType_t count = uxTaskGetSystemState(task_status, PROFILER_MAX_TASKS, &total);
+    if (count == 0) {
+        // Array smaller than the task list - nothing is filled in
+        if (!overflow_reported) {
+            Serial.printf("[Profile] More than %d tasks - raise PROFILER_MAX_TASKS\n", PROFILER_MAX_TASKS);
+            overflow_reported = true;
+        }
+        prev_count = 0;
+        return;
+    }
+
+    uint32_t elapsed = total - prev_total;
+    snap.cpu_valid = PROFILER_RUN_TIME_STATS && prev_count > 0 && elapsed > 0;
+
+    TaskHandle_t idle[2] = {xTaskGetIdleTaskHandleForCPU(0), xTaskGetIdleTaskHandleForCPU(1)};
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        const TaskStatus_t& status = task_status[i];
+        TaskProfile& task = snap.tasks[i];
+
+        snprintf(task.name, sizeof(task.name), "%s", status.pcTaskName);
+        task.stack_free = status.usStackHighWaterMark;  // Same value as uxTaskGetStackHighWaterMark()
+        task.priority = (uint8_t)status.uxCurrentPriority;
+        BaseType_t affinity = xTaskGetAffinity(status.xHandle);
+        task.core = (affinity == tskNO_AFFINITY) ? -1 : (int8_t)affinity;
+
+        task.cpu_x10 = 0;
+        if (snap.cpu_valid) {
+            uint32_t ran = status.ulRunTimeCounter - previousRunTime(status.xHandle);
+            uint64_t share = (uint64_t)ran * 1000 / elapsed;
+            task.cpu_x10 = (uint16_t)(share < 1000 ? share : 1000);
+
+            for (uint8_t core = 0; core < 2; core++) {
+                if (status.xHandle == idle[core]) snap.core_load_x10[core] = 1000 - task.cpu_x10;
+            }
+        }
+    }
+    snap.task_count = (uint8_t)count;
+
+    // Counters for the next interval
+    for (UBaseType_t i = 0; i < count; i++) {
+        prev_handles[i] = task_status[i].xHandle;
+        prev_runtime[i] = task_status[i].ulRunTimeCounter;
+    }
+    prev_count = (uint8_t)count;
+    prev_total = total;
+
+    sortTasks(snap);
+#endif
+}
+
+static void sampleHeap(ProfileSnapshot& snap) {
+    const uint32_t internal = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    snap.heap_free = heap_caps_get_free_size(internal);
+    snap.heap_min = heap_caps_get_minimum_free_size(internal);
+    snap.heap_largest = heap_caps_get_largest_free_block(internal);
+
+    snap.psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    snap.psram_min = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+    snap.psram_largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+}
+
+static void takeSample(uint32_t now) {
+    sample.interval_ms = has_sample ? now - last_sample_ms : 0;
+    sample.time_ms = now;
+
+    sampleTasks(sample);
+    sampleHeap(sample);
+
+    sample.loop_late_p95_us = metricsPercentile(loop_late_us, 95);
+    sample.loop_late_max_us = loop_late_us.max.load(std::memory_order_relaxed);
+    sample.loop_wakes = loop_late_us.count.load(std::memory_order_relaxed);
+
+    profile_snapshot.write(sample);
+}
+
+// ============================================================================
+// LOG OUTPUT
+// ============================================================================
+
+/**
+ * One line: core loads, heap, loop jitter and the task closest to its stack end
+ */
+static void logSummary(const ProfileSnapshot& snap) {
+    const TaskProfile* tightest = NULL;
+    for (uint8_t i = 0; i < snap.task_count; i++) {
+        if (!tightest || snap.tasks[i].stack_free < tightest->stack_free) tightest = &snap.tasks[i];
+    }
+
+    if (snap.cpu_valid) {
+        Serial.printf("[Profile] CPU core0 %u.%u%% core1 %u.%u%%",
+                      snap.core_load_x10[0] / 10, snap.core_load_x10[0] % 10,
+                      snap.core_load_x10[1] / 10, snap.core_load_x10[1] % 10);
+    } else {
+        Serial.print("[Profile] CPU n/a");
+    }
+    Serial.printf(" | heap %lu KB (min %lu, frag %u%%) | PSRAM %lu KB | loop late p95 %lu us max %lu us",
+                  (unsigned long)(snap.heap_free / 1024), (unsigned long)(snap.heap_min / 1024),
+                  profilerFragmentation(snap.heap_free, snap.heap_largest),
+                  (unsigned long)(snap.psram_free / 1024),
+                  (unsigned long)snap.loop_late_p95_us, (unsigned long)snap.loop_late_max_us);
+    if (tightest) {
+        Serial.printf(" | stack %s %lu B", tightest->name, (unsigned long)tightest->stack_free);
+    }
+    Serial.println();
+}
+
+void profilerDump() {
+    const ProfileSnapshot& snap = sample;  // Input loop: the latest sample is its own
+    if (snap.time_ms == 0) {
+        Serial.println("[Tasks] no sample yet");
+        return;
+    }
+
+    if (snap.cpu_valid) {
+        Serial.printf("[Tasks] CPU share of one core over %lu ms, stack headroom (bytes)\n",
+                      (unsigned long)snap.interval_ms);
+        Serial.printf("  Core 0 %u.%u%%  Core 1 %u.%u%%\n",
+                      snap.core_load_x10[0] / 10, snap.core_load_x10[0] % 10,
+                      snap.core_load_x10[1] / 10, snap.core_load_x10[1] % 10);
+    } else {
+        Serial.println("[Tasks] stack headroom (bytes), CPU n/a (configGENERATE_RUN_TIME_STATS off)");
+    }
+    Serial.println("  Task              Core Prio  CPU %   Stack free");
+    for (uint8_t i = 0; i < snap.task_count; i++) {
+        const TaskProfile& task = snap.tasks[i];
+        char core[4];
+        if (task.core < 0) snprintf(core, sizeof(core), "-");
+        else snprintf(core, sizeof(core), "%d", task.core);
+        Serial.printf("  %-16s  %-4s %4u  %3u.%u   %6lu%s\n", task.name, core, task.priority,
+                      task.cpu_x10 / 10, task.cpu_x10 % 10, (unsigned long)task.stack_free,
+                      task.stack_free < PROFILER_STACK_WARN_BYTES ? "  LOW" : "");
+    }
+
+    Serial.println("[Heap] bytes");
+    Serial.printf("  Internal  free=%lu min=%lu largest=%lu frag=%u%%\n",
+                  (unsigned long)snap.heap_free, (unsigned long)snap.heap_min,
+                  (unsigned long)snap.heap_largest,
+                  profilerFragmentation(snap.heap_free, snap.heap_largest));
+    Serial.printf("  PSRAM     free=%lu min=%lu largest=%lu frag=%u%%\n",
+                  (unsigned long)snap.psram_free, (unsigned long)snap.psram_min,
+                  (unsigned long)snap.psram_largest,
+                  profilerFragmentation(snap.psram_free, snap.psram_largest));
+    Serial.printf("  Loop wake lateness  n=%lu p95=%lu max=%lu us (behind %d ms idle wake)\n",
+                  (unsigned long)snap.loop_wakes, (unsigned long)snap.loop_late_p95_us,
+                  (unsigned long)snap.loop_late_max_us, BTN_IDLE_WAKE_MS);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void serviceProfiler(uint32_t now) {
+    if (has_sample && now - last_sample_ms < PROFILER_SAMPLE_MS) return;
+
+    takeSample(now);
+    last_sample_ms = now;
+    has_sample = true;
+
+    if (PROFILER_LOG_MS > 0 && now - last_log_ms >= PROFILER_LOG_MS) {
+        logSummary(sample);
+        last_log_ms = now;
+    }
+}
+
+void profilerRecordLoopWake(uint32_t slept_us) {
+    const uint32_t expected_us = (uint32_t)BTN_IDLE_WAKE_MS * 1000;
+    metricsRecord(loop_late_us, slept_us > expected_us ? slept_us - expected_us : 0);
+}
+
+void getProfileSnapshot(ProfileSnapshot& out) {
+    profile_snapshot.read(out);
+}
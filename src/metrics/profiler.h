@@ -0,0 +1,96 @@
+/**
+ * Profiler Module
+ *
+ * Per-task CPU and stack usage plus heap state, sampled every
+ * PROFILER_SAMPLE_MS by the input loop:
+ * - All FreeRTOS tasks (OBD2Task, ELMEngine, DisplayTask, loopTask, the
+ *   BT stack's BTC_TASK/BTU_TASK/btController, IDLE0/IDLE1, ...):
+ *   stack high-water mark, priority, core and CPU share of the last interval
+ *   from the run-time counters (configGENERATE_RUN_TIME_STATS)
+ * - Load per core (100% minus its idle task)
+ * - Internal heap and PSRAM: free, minimum since boot, largest block
+ *   (fragmentation = share of free memory outside the largest block)
+ * - Input loop jitter: lateness of the idle wake-ups behind BTN_IDLE_WAKE_MS
+ *   (starvation of Core 1 by the display task or the radio)
+ *
+ * The sample is published as a SeqLock snapshot for the stats page (tasks
+ * view), printed with the metrics dump and as a summary line every
+ * PROFILER_LOG_MS.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+struct TaskProfile {
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t stack_free;    // Least free stack since the task started (bytes)
+    uint16_t cpu_x10;       // Share of one core over the last interval (0.1 % units)
+    uint8_t priority;
+    int8_t core;            // Pinned core, -1 = either
+};
+
+struct ProfileSnapshot {
+    uint32_t time_ms;           // Sample time (0 = no sample yet)
+    uint32_t interval_ms;       // Time covered by the CPU figures
+    bool cpu_valid;             // Run-time counters available and two samples taken
+    uint8_t task_count;         // Entries in tasks[] (busiest first)
+    uint16_t core_load_x10[2];  // Per core (0.1 % units)
+    TaskProfile tasks[PROFILER_MAX_TASKS];
+
+    uint32_t heap_free;         // Internal RAM
+    uint32_t heap_min;
+    uint32_t heap_largest;
+    uint32_t psram_free;        // 0 without PSRAM
+    uint32_t psram_min;
+    uint32_t psram_largest;
+
+    uint32_t loop_late_p95_us;  // Input loop idle wake-up lateness
+    uint32_t loop_late_max_us;
+    uint32_t loop_wakes;        // Idle wake-ups measured
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Take a sample once PROFILER_SAMPLE_MS passed, log the summary line once
+ * PROFILER_LOG_MS passed (input loop, every wake-up)
+ * @param now Current time (ms)
+ */
+void serviceProfiler(uint32_t now);
+
+/**
+ * Record one idle wake-up of the input loop (input loop only)
+ * @param slept_us Time spent in the wait that timed out
+ */
+void profilerRecordLoopWake(uint32_t slept_us);
+
+/**
+ * Copy the latest sample (any task)
+ */
+void getProfileSnapshot(ProfileSnapshot& out);
+
+/**
+ * Fragmentation of a heap region
+ * @return Percent of the free memory outside the largest free block
+ */
+inline uint8_t profilerFragmentation(uint32_t free_bytes, uint32_t largest) {
+    if (free_bytes == 0 || largest >= free_bytes) return 0;
+    return (uint8_t)(100 - (uint64_t)largest * 100 / free_bytes);
+}
+
+/**
+ * Print the task table and heap state of the latest sample to Serial
+ * (part of metricsDump(), input loop only)
+ */
+void profilerDump();
+
+#endif // PROFILER_H
@@ -51,8 +51,8 @@ bool connectBluetooth() {
         Serial.println("ERROR: Bluetooth connection failed!");
 
         // Check if we're actually connected despite connect() returning false
-        delay(1000);
-        if (SerialBT.connected()) {
+        // (waits only until the link reports up, at most 1 s)
+        if (SerialBT.connected(1000)) {
             Serial.println("WARNING: connect() failed but SerialBT.connected() is true!");
             Serial.println("Proceeding with connection...");
         } else {
@@ -75,12 +75,29 @@ bool connectBluetooth() {
     Serial.println("✓ Bluetooth connected successfully!");
     Serial.printf("Connection status: %s\n", SerialBT.connected() ? "CONNECTED" : "DISCONNECTED");
 
-    // Wait for connection to stabilize
-    Serial.println("Waiting for connection to stabilize...");
-    delay(ELM327_INIT_DELAY_MS);
+    // No settle delay: initELM327() waits for the adapter prompt instead
+    return true;
+}
+
+bool reconnectBluetooth() {
+    Serial.println("[BT] Fast reconnect (stack kept up)...");
+
+    if (SerialBT.connected()) {
+        SerialBT.disconnect();
+    }
 
-    Serial.printf("After delay - connected: %s\n", SerialBT.connected() ? "true" : "false");
+    // connect() without arguments reuses the last remote address/channel
+    if (!SerialBT.connect() && !SerialBT.connected(BT_FAST_RECONNECT_TIMEOUT_MS)) {
+        Serial.println("[BT] Fast reconnect failed");
+        return false;
+    }
+
+    // Drop anything the adapter sent while the link was half-open
+    while (SerialBT.available()) {
+        SerialBT.read();
+    }
 
+    Serial.println("[BT] Fast reconnect OK");
     return true;
 }
 
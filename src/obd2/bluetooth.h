@@ -5,7 +5,7 @@
  * - Initialization
  * - Connection management (MAC address or device name)
  * - Connection monitoring
- * - Automatic reconnection
+ * - Fast SPP reconnect (keeps the Bluetooth stack up)
  */
 
 #ifndef BLUETOOTH_H
@@ -39,7 +39,16 @@ void initBluetooth();
 bool connectBluetooth();
 
 /**
- * Disconnect Bluetooth connection
+ * Re-open the SPP link to the last remote device
+ * Keeps the Bluetooth stack initialized (no end()/begin(), no settle delay),
+ * so a dropped link comes back in well under a second when the adapter is in range
+ * @return true if the link is up again within BT_FAST_RECONNECT_TIMEOUT_MS
+ */
+bool reconnectBluetooth();
+
+/**
+ * Disconnect Bluetooth connection and shut down the Bluetooth stack
+ * Call initBluetooth() before connecting again
  */
 void disconnectBluetooth();
 
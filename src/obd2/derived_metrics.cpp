@@ -0,0 +1,195 @@
+/**
+ * Derived Metrics Module - Implementation
+ */
+
+#include "derived_metrics.h"
+#include <math.h>
+
+// ============================================================================
+// FIXED-POINT HELPERS
+// ============================================================================
+
+static const int32_t NO_VALUE = INT32_MIN;              // Input not received yet
+static const int32_t STANDARD_BARO_PA = 101325;         // Until PID 0x33 is read
+static const int32_t ZERO_CELSIUS_MK = 273150;          // 0 °C in milli-kelvin
+
+/**
+ * Float PID value to milli-units
+ */
+static int32_t toMilli(float value) {
+    return (int32_t)lroundf(value * 1000.0f);
+}
+
+/**
+ * Milli-units to float (NAN for NO_VALUE)
+ */
+static float fromMilli(int32_t milli) {
+    return milli == NO_VALUE ? NAN : milli / 1000.0f;
+}
+
+static void initEMA(FixedEMA& ema, uint8_t shift) {
+    ema.state = 0;
+    ema.shift = shift;
+    ema.primed = false;
+}
+
+/**
+ * Add one sample (milli-units)
+ */
+static void updateEMA(FixedEMA& ema, int32_t milli) {
+    int32_t target = milli * (1 << EMA_FRACTION_BITS);
+    if (!ema.primed) {
+        ema.state = target;
+        ema.primed = true;
+        return;
+    }
+    ema.state += (target - ema.state) / (1 << ema.shift);
+}
+
+/**
+ * Filtered value in milli-units (NO_VALUE before the first sample)
+ */
+static int32_t emaValue(const FixedEMA& ema) {
+    return ema.primed ? ema.state / (1 << EMA_FRACTION_BITS) : NO_VALUE;
+}
+
+// ============================================================================
+// STATE (OBD2 task only)
+// ============================================================================
+
+// Latest raw inputs (milli-units, NO_VALUE until received)
+static int32_t rpm_milli;
+static int32_t speed_milli;         // km/h
+static int32_t intake_milli;        // °C
+static int32_t map_pa;              // kPa in milli-units = Pa
+static int32_t maf_mg_s;            // g/s in milli-units = mg/s
+static int32_t baro_pa;
+static bool airflow_fresh;          // MAF, MAP, RPM or IAT changed since the last update
+
+static FixedEMA fuel_ema;           // mL/h
+static FixedEMA speed_ema;          // milli km/h (consumption divisor)
+static FixedEMA load_ema;           // milli %
+static FixedEMA map_ema;            // Pa
+
+// Trip totals since boot
+static uint64_t trip_fuel_ul;       // µL
+static uint64_t trip_distance_mm;
+static int32_t fuel_mlph;           // Latest unfiltered fuel rate (integrated)
+static uint32_t last_update_ms;
+static bool has_last_update;
+
+// ============================================================================
+// COMPUTATION
+// ============================================================================
+
+/**
+ * Intake airflow in mg/s, or NO_VALUE if the inputs are missing
+ * Speed-density: rho = p / (R * T), flow = rho * displacement * rpm / 120 * VE
+ */
+static int32_t airflowMgPerSecond() {
+    if (maf_mg_s != NO_VALUE) return maf_mg_s;
+    if (map_pa == NO_VALUE || rpm_milli == NO_VALUE || intake_milli == NO_VALUE) return NO_VALUE;
+
+    // mg/s = Pa * cc * rpm * VE% * 100 / (R[28705 = 287.05 * 100] * T[mK] * 12)
+    int64_t temp_mk = (int64_t)intake_milli + ZERO_CELSIUS_MK;
+    int64_t numerator = (int64_t)map_pa * DERIVED_DISPLACEMENT_CC * (rpm_milli / 1000) *
+                        DERIVED_VE_PERCENT * 100;
+    return (int32_t)(numerator / (28705LL * temp_mk * 12));
+}
+
+/**
+ * Fuel rate in mL/h from airflow: air / AFR / density
+ */
+static int32_t fuelRateMlPerHour(int32_t airflow_mg_s) {
+    return (int32_t)((int64_t)airflow_mg_s * 10 * 3600 /
+                     (DERIVED_AFR_X10 * DERIVED_FUEL_DENSITY_G_L));
+}
+
+void resetDerivedMetrics() {
+    rpm_milli = NO_VALUE;
+    speed_milli = NO_VALUE;
+    intake_milli = NO_VALUE;
+    map_pa = NO_VALUE;
+    maf_mg_s = NO_VALUE;
+    baro_pa = STANDARD_BARO_PA;
+    airflow_fresh = false;
+
+    initEMA(fuel_ema, DERIVED_EMA_SHIFT_FUEL);
+    initEMA(speed_ema, DERIVED_EMA_SHIFT_SPEED);
+    initEMA(load_ema, DERIVED_EMA_SHIFT_LOAD);
+    initEMA(map_ema, DERIVED_EMA_SHIFT_MAP);
+
+    trip_fuel_ul = 0;
+    trip_distance_mm = 0;
+    fuel_mlph = NO_VALUE;
+    last_update_ms = 0;
+    has_last_update = false;
+}
+
+void derivedMetricsSample(uint8_t pid, float value) {
+    int32_t milli = toMilli(value);
+
+    switch (pid) {
+        case PID_RPM:         rpm_milli = milli; airflow_fresh = true; break;
+        case PID_INTAKE_TEMP: intake_milli = milli; airflow_fresh = true; break;
+        case PID_MAF:         maf_mg_s = milli; airflow_fresh = true; break;
+        case PID_MAP:
+            map_pa = milli;
+            airflow_fresh = true;
+            updateEMA(map_ema, milli);
+            break;
+        case PID_BARO:        baro_pa = milli; break;
+        case PID_SPEED:
+            speed_milli = milli;
+            updateEMA(speed_ema, milli);
+            break;
+        case PID_ENGINE_LOAD: updateEMA(load_ema, milli); break;
+    }
+}
+
+void derivedMetricsUpdate(uint32_t now, DerivedValues& out) {
+    // Filter the fuel rate once per airflow change, not once per poll
+    if (airflow_fresh) {
+        int32_t airflow = airflowMgPerSecond();
+        if (airflow != NO_VALUE) {
+            fuel_mlph = fuelRateMlPerHour(airflow);
+            updateEMA(fuel_ema, fuel_mlph);
+        }
+        airflow_fresh = false;
+    }
+
+    // Integrate fuel and distance over the time since the last poll
+    uint32_t elapsed = now - last_update_ms;
+    if (has_last_update && elapsed <= DERIVED_MAX_GAP_MS) {
+        if (fuel_mlph != NO_VALUE) {
+            trip_fuel_ul += (uint64_t)fuel_mlph * elapsed / 3600;      // mL/h * ms -> µL
+        }
+        if (speed_milli != NO_VALUE) {
+            trip_distance_mm += (uint64_t)speed_milli * elapsed / 3600; // milli km/h * ms -> mm
+        }
+    }
+    last_update_ms = now;
+    has_last_update = true;
+
+    // Instant consumption: filtered fuel rate over filtered speed (L/100km = L/h * 100 / km/h)
+    int32_t fuel = emaValue(fuel_ema);
+    int32_t speed = emaValue(speed_ema);
+    int32_t consumption = NO_VALUE;
+    if (fuel != NO_VALUE && speed != NO_VALUE && speed >= DERIVED_MIN_SPEED_KMH * 1000) {
+        consumption = (int32_t)((int64_t)fuel * 100000 / speed);
+    }
+
+    // Trip average: µL * 100 / mm = L/100km in milli-units
+    int32_t trip = NO_VALUE;
+    if (trip_distance_mm >= (uint64_t)DERIVED_TRIP_MIN_M * 1000) {
+        trip = (int32_t)(trip_fuel_ul * 100000 / trip_distance_mm);
+    }
+
+    int32_t manifold = emaValue(map_ema);
+
+    out.fuel_rate = fromMilli(fuel);
+    out.consumption = fromMilli(consumption);
+    out.trip_consumption = fromMilli(trip);
+    out.engine_load = fromMilli(emaValue(load_ema));
+    out.boost = manifold != NO_VALUE ? (manifold - baro_pa) / 1000.0f : NAN;
+}
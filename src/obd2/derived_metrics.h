@@ -0,0 +1,75 @@
+/**
+ * Derived Metrics Module
+ *
+ * Signals computed from the polled Mode 01 PIDs on Core 0 (no extra queries):
+ * - Fuel rate (L/h) from airflow: MAF if the ECU reports it, else
+ *   speed-density from MAP, intake temperature and RPM
+ * - Instant consumption (L/100km) from fuel rate and speed
+ * - Trip average (L/100km) from integrated fuel and distance since boot
+ * - Engine load (%) and boost (kPa above barometric pressure)
+ *
+ * All math is integer fixed-point (milli-units), smoothed by shift-based EMA
+ * filters. Values are published as floats in LiveData, so the display only
+ * quantizes them like raw PIDs. NAN marks "not known yet" (shown as "--").
+ *
+ * Time is passed in by the caller (millis()), no Arduino dependencies
+ */
+
+#ifndef DERIVED_METRICS_H
+#define DERIVED_METRICS_H
+
+#include <stdint.h>
+#include "config.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+// Fraction bits of the EMA state (below milli-units)
+#define EMA_FRACTION_BITS   8
+
+/**
+ * Exponential moving average on integers: state += (x - state) / 2^shift
+ */
+struct FixedEMA {
+    int32_t state;          // Filtered value, milli-units << EMA_FRACTION_BITS
+    uint8_t shift;          // Weight of a new sample: 1 / 2^shift
+    bool primed;            // First sample loaded (no ramp from zero)
+};
+
+/**
+ * Derived values for LiveData (NAN = not known yet)
+ */
+struct DerivedValues {
+    float fuel_rate;            // L/h
+    float consumption;          // L/100km (NAN below DERIVED_MIN_SPEED_KMH)
+    float trip_consumption;     // L/100km since boot (NAN before DERIVED_TRIP_MIN_M)
+    float engine_load;          // %
+    float boost;                // kPa above barometric pressure (negative = vacuum)
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Reset filters and the trip totals
+ */
+void resetDerivedMetrics();
+
+/**
+ * Feed one decoded PID value (PIDs without a derived use are ignored)
+ * @param pid Mode 01 PID
+ * @param value Decoded value (decodePIDValue)
+ */
+void derivedMetricsSample(uint8_t pid, float value);
+
+/**
+ * Advance filters and trip totals after a poll's samples were fed
+ * Gaps longer than DERIVED_MAX_GAP_MS (reconnects) are not integrated
+ * @param now Time of the poll (ms)
+ * @param out Current derived values
+ */
+void derivedMetricsUpdate(uint32_t now, DerivedValues& out);
+
+#endif // DERIVED_METRICS_H
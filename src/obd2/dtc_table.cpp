@@ -0,0 +1,288 @@
+/**
+ * DTC Table Module - Implementation
+ */
+
+#include "dtc_table.h"
+#include <stdio.h>
+
+// ============================================================================
+// DTC TABLE (sorted by raw value - checked at compile time)
+// ============================================================================
+
+static constexpr DTCInfo dtc_table[] = {
+    {0x0010, DTC_SEVERITY_WARNING, "Camshaft Actuator Circuit B1"},           // P0010
+    {0x0011, DTC_SEVERITY_WARNING, "Camshaft Timing Over-Advanced B1"},       // P0011
+    {0x0012, DTC_SEVERITY_WARNING, "Camshaft Timing Over-Retarded B1"},       // P0012
+    {0x0013, DTC_SEVERITY_WARNING, "Exhaust Camshaft Actuator Circuit B1"},   // P0013
+    {0x0014, DTC_SEVERITY_WARNING, "Exhaust Camshaft Timing Over-Advanced B1"},// P0014
+    {0x0016, DTC_SEVERITY_CRITICAL, "Crankshaft/Camshaft Correlation"},       // P0016
+    {0x0017, DTC_SEVERITY_CRITICAL, "Crankshaft/Camshaft Correlation B1"},    // P0017
+    {0x0030, DTC_SEVERITY_INFO, "O2 Sensor Heater Control Circuit B1S1"},     // P0030
+    {0x0036, DTC_SEVERITY_INFO, "O2 Sensor Heater Control Circuit B1S2"},     // P0036
+    {0x0068, DTC_SEVERITY_WARNING, "MAP/MAF - Throttle Position Correlation"},// P0068
+    {0x0087, DTC_SEVERITY_WARNING, "Fuel Rail Pressure Too Low"},             // P0087
+    {0x0088, DTC_SEVERITY_WARNING, "Fuel Rail Pressure Too High"},            // P0088
+    {0x0100, DTC_SEVERITY_INFO, "MAF Sensor Circuit Malfunction"},            // P0100
+    {0x0101, DTC_SEVERITY_INFO, "MAF Sensor Range/Performance"},              // P0101
+    {0x0102, DTC_SEVERITY_INFO, "MAF Sensor Circuit Low"},                    // P0102
+    {0x0103, DTC_SEVERITY_INFO, "MAF Sensor Circuit High"},                   // P0103
+    {0x0105, DTC_SEVERITY_INFO, "MAP Sensor Circuit Malfunction"},            // P0105
+    {0x0106, DTC_SEVERITY_INFO, "MAP Sensor Range/Performance"},              // P0106
+    {0x0107, DTC_SEVERITY_INFO, "MAP Sensor Circuit Low"},                    // P0107
+    {0x0108, DTC_SEVERITY_INFO, "MAP Sensor Circuit High"},                   // P0108
+    {0x0110, DTC_SEVERITY_INFO, "Intake Air Temp Sensor Circuit"},            // P0110
+    {0x0112, DTC_SEVERITY_INFO, "Intake Air Temp Sensor Low"},                // P0112
+    {0x0113, DTC_SEVERITY_INFO, "Intake Air Temp Sensor High"},               // P0113
+    {0x0115, DTC_SEVERITY_INFO, "Coolant Temp Sensor Circuit"},               // P0115
+    {0x0116, DTC_SEVERITY_INFO, "Coolant Temp Sensor Range"},                 // P0116
+    {0x0117, DTC_SEVERITY_INFO, "Coolant Temp Sensor Low"},                   // P0117
+    {0x0118, DTC_SEVERITY_INFO, "Coolant Temp Sensor High"},                  // P0118
+    {0x0120, DTC_SEVERITY_INFO, "Throttle Position Sensor Circuit"},          // P0120
+    {0x0121, DTC_SEVERITY_INFO, "Throttle Position Sensor Range/Perf"},       // P0121
+    {0x0122, DTC_SEVERITY_INFO, "Throttle Position Sensor Low"},              // P0122
+    {0x0123, DTC_SEVERITY_INFO, "Throttle Position Sensor High"},             // P0123
+    {0x0125, DTC_SEVERITY_INFO, "Coolant Temp Too Low for Closed Loop"},      // P0125
+    {0x0128, DTC_SEVERITY_WARNING, "Coolant Thermostat Malfunction"},         // P0128
+    {0x0130, DTC_SEVERITY_INFO, "O2 Sensor Circuit B1S1"},                    // P0130
+    {0x0131, DTC_SEVERITY_INFO, "O2 Sensor Circuit Low Voltage B1S1"},        // P0131
+    {0x0132, DTC_SEVERITY_INFO, "O2 Sensor Circuit High Voltage B1S1"},       // P0132
+    {0x0133, DTC_SEVERITY_WARNING, "O2 Sensor Slow Response B1S1"},           // P0133
+    {0x0134, DTC_SEVERITY_WARNING, "O2 Sensor No Activity B1S1"},             // P0134
+    {0x0135, DTC_SEVERITY_WARNING, "O2 Sensor Heater B1S1"},                  // P0135
+    {0x0136, DTC_SEVERITY_INFO, "O2 Sensor Circuit B1S2"},                    // P0136
+    {0x0137, DTC_SEVERITY_INFO, "O2 Sensor Circuit Low Voltage B1S2"},        // P0137
+    {0x0138, DTC_SEVERITY_INFO, "O2 Sensor Circuit High Voltage B1S2"},       // P0138
+    {0x0140, DTC_SEVERITY_INFO, "O2 Sensor No Activity B1S2"},                // P0140
+    {0x0141, DTC_SEVERITY_WARNING, "O2 Sensor Heater B1S2"},                  // P0141
+    {0x0171, DTC_SEVERITY_WARNING, "System Too Lean B1"},                     // P0171
+    {0x0172, DTC_SEVERITY_WARNING, "System Too Rich B1"},                     // P0172
+    {0x0174, DTC_SEVERITY_WARNING, "System Too Lean B2"},                     // P0174
+    {0x0175, DTC_SEVERITY_WARNING, "System Too Rich B2"},                     // P0175
+    {0x0200, DTC_SEVERITY_WARNING, "Injector Circuit Malfunction"},           // P0200
+    {0x0201, DTC_SEVERITY_WARNING, "Injector Circuit Cylinder 1"},            // P0201
+    {0x0202, DTC_SEVERITY_WARNING, "Injector Circuit Cylinder 2"},            // P0202
+    {0x0203, DTC_SEVERITY_WARNING, "Injector Circuit Cylinder 3"},            // P0203
+    {0x0204, DTC_SEVERITY_WARNING, "Injector Circuit Cylinder 4"},            // P0204
+    {0x0217, DTC_SEVERITY_CRITICAL, "Engine Overheat Condition"},             // P0217
+    {0x0218, DTC_SEVERITY_CRITICAL, "Transmission Overheat"},                 // P0218
+    {0x0219, DTC_SEVERITY_CRITICAL, "Engine Overspeed Condition"},            // P0219
+    {0x0220, DTC_SEVERITY_INFO, "Throttle Position Sensor B Circuit"},        // P0220
+    {0x0221, DTC_SEVERITY_INFO, "Throttle Position Sensor B Range/Perf"},     // P0221
+    {0x0230, DTC_SEVERITY_WARNING, "Fuel Pump Primary Circuit"},              // P0230
+    {0x0234, DTC_SEVERITY_CRITICAL, "Turbo/Supercharger Overboost"},          // P0234
+    {0x0244, DTC_SEVERITY_WARNING, "Wastegate Solenoid"},                     // P0244
+    {0x0261, DTC_SEVERITY_WARNING, "Injector Circuit Low Cylinder 1"},        // P0261
+    {0x0262, DTC_SEVERITY_WARNING, "Injector Circuit High Cylinder 1"},       // P0262
+    {0x0299, DTC_SEVERITY_WARNING, "Turbo/Supercharger Underboost"},          // P0299
+    {0x0300, DTC_SEVERITY_CRITICAL, "Random Misfire Detected"},               // P0300
+    {0x0301, DTC_SEVERITY_CRITICAL, "Cylinder 1 Misfire"},                    // P0301
+    {0x0302, DTC_SEVERITY_CRITICAL, "Cylinder 2 Misfire"},                    // P0302
+    {0x0303, DTC_SEVERITY_CRITICAL, "Cylinder 3 Misfire"},                    // P0303
+    {0x0304, DTC_SEVERITY_CRITICAL, "Cylinder 4 Misfire"},                    // P0304
+    {0x0305, DTC_SEVERITY_CRITICAL, "Cylinder 5 Misfire"},                    // P0305
+    {0x0306, DTC_SEVERITY_CRITICAL, "Cylinder 6 Misfire"},                    // P0306
+    {0x0307, DTC_SEVERITY_CRITICAL, "Cylinder 7 Misfire"},                    // P0307
+    {0x0308, DTC_SEVERITY_CRITICAL, "Cylinder 8 Misfire"},                    // P0308
+    {0x0325, DTC_SEVERITY_WARNING, "Knock Sensor Circuit B1"},                // P0325
+    {0x0327, DTC_SEVERITY_WARNING, "Knock Sensor Circuit Low B1"},            // P0327
+    {0x0328, DTC_SEVERITY_WARNING, "Knock Sensor Circuit High B1"},           // P0328
+    {0x0335, DTC_SEVERITY_CRITICAL, "Crankshaft Position Sensor"},            // P0335
+    {0x0336, DTC_SEVERITY_CRITICAL, "Crankshaft Position Sensor Range/Perf"}, // P0336
+    {0x0340, DTC_SEVERITY_CRITICAL, "Camshaft Position Sensor"},              // P0340
+    {0x0341, DTC_SEVERITY_CRITICAL, "Camshaft Position Sensor Range/Perf"},   // P0341
+    {0x0351, DTC_SEVERITY_WARNING, "Ignition Coil A Circuit"},                // P0351
+    {0x0352, DTC_SEVERITY_WARNING, "Ignition Coil B Circuit"},                // P0352
+    {0x0353, DTC_SEVERITY_WARNING, "Ignition Coil C Circuit"},                // P0353
+    {0x0354, DTC_SEVERITY_WARNING, "Ignition Coil D Circuit"},                // P0354
+    {0x0380, DTC_SEVERITY_WARNING, "Glow Plug Circuit"},                      // P0380
+    {0x0400, DTC_SEVERITY_WARNING, "EGR Flow Malfunction"},                   // P0400
+    {0x0401, DTC_SEVERITY_WARNING, "EGR Insufficient Flow"},                  // P0401
+    {0x0402, DTC_SEVERITY_WARNING, "EGR Excessive Flow"},                     // P0402
+    {0x0403, DTC_SEVERITY_WARNING, "EGR Circuit Malfunction"},                // P0403
+    {0x0404, DTC_SEVERITY_WARNING, "EGR Circuit Range/Performance"},          // P0404
+    {0x0410, DTC_SEVERITY_WARNING, "Secondary Air Injection System"},         // P0410
+    {0x0411, DTC_SEVERITY_WARNING, "Secondary Air Injection"},                // P0411
+    {0x0420, DTC_SEVERITY_WARNING, "Catalyst Efficiency Low B1"},             // P0420
+    {0x0430, DTC_SEVERITY_WARNING, "Catalyst Efficiency Low B2"},             // P0430
+    {0x0440, DTC_SEVERITY_WARNING, "EVAP System Malfunction"},                // P0440
+    {0x0441, DTC_SEVERITY_WARNING, "EVAP Incorrect Purge Flow"},              // P0441
+    {0x0442, DTC_SEVERITY_WARNING, "EVAP System Small Leak"},                 // P0442
+    {0x0443, DTC_SEVERITY_WARNING, "EVAP Purge Valve Circuit"},               // P0443
+    {0x0446, DTC_SEVERITY_WARNING, "EVAP Vent Control Circuit"},              // P0446
+    {0x0455, DTC_SEVERITY_WARNING, "EVAP System Large Leak"},                 // P0455
+    {0x0456, DTC_SEVERITY_WARNING, "EVAP System Very Small Leak"},            // P0456
+    {0x0461, DTC_SEVERITY_INFO, "Fuel Level Sensor Range/Perf"},              // P0461
+    {0x0462, DTC_SEVERITY_INFO, "Fuel Level Sensor Circuit Low"},             // P0462
+    {0x0463, DTC_SEVERITY_INFO, "Fuel Level Sensor Circuit High"},            // P0463
+    {0x0480, DTC_SEVERITY_WARNING, "Cooling Fan 1 Control Circuit"},          // P0480
+    {0x0500, DTC_SEVERITY_WARNING, "Vehicle Speed Sensor Malfunction"},       // P0500
+    {0x0501, DTC_SEVERITY_WARNING, "Vehicle Speed Sensor Range/Perf"},        // P0501
+    {0x0505, DTC_SEVERITY_WARNING, "Idle Control System Malfunction"},        // P0505
+    {0x0506, DTC_SEVERITY_INFO, "Idle RPM Lower Than Expected"},              // P0506
+    {0x0507, DTC_SEVERITY_INFO, "Idle RPM Higher Than Expected"},             // P0507
+    {0x0520, DTC_SEVERITY_WARNING, "Oil Pressure Sensor Circuit"},            // P0520
+    {0x0521, DTC_SEVERITY_WARNING, "Oil Pressure Sensor Range/Perf"},         // P0521
+    {0x0522, DTC_SEVERITY_CRITICAL, "Oil Pressure Sensor Low"},               // P0522
+    {0x0523, DTC_SEVERITY_CRITICAL, "Oil Pressure Sensor High"},              // P0523
+    {0x0524, DTC_SEVERITY_CRITICAL, "Engine Oil Pressure Too Low"},           // P0524
+    {0x0530, DTC_SEVERITY_INFO, "A/C Refrigerant Pressure Sensor"},           // P0530
+    {0x0560, DTC_SEVERITY_WARNING, "System Voltage Malfunction"},             // P0560
+    {0x0562, DTC_SEVERITY_INFO, "System Voltage Low"},                        // P0562
+    {0x0563, DTC_SEVERITY_INFO, "System Voltage High"},                       // P0563
+    {0x0571, DTC_SEVERITY_INFO, "Brake Switch A Circuit"},                    // P0571
+    {0x0600, DTC_SEVERITY_WARNING, "Serial Communication Link"},              // P0600
+    {0x0601, DTC_SEVERITY_CRITICAL, "ECM Memory Checksum Error"},             // P0601
+    {0x0603, DTC_SEVERITY_WARNING, "ECM Keep Alive Memory Error"},            // P0603
+    {0x0604, DTC_SEVERITY_CRITICAL, "ECM RAM Error"},                         // P0604
+    {0x0605, DTC_SEVERITY_CRITICAL, "ECM ROM Error"},                         // P0605
+    {0x0606, DTC_SEVERITY_WARNING, "ECM Processor Fault"},                    // P0606
+    {0x0641, DTC_SEVERITY_WARNING, "Sensor Reference Voltage A Circuit"},     // P0641
+    {0x0650, DTC_SEVERITY_INFO, "MIL Control Circuit"},                       // P0650
+    {0x0700, DTC_SEVERITY_WARNING, "Transmission Control System"},            // P0700
+    {0x0705, DTC_SEVERITY_WARNING, "Transmission Range Sensor Circuit"},      // P0705
+    {0x0715, DTC_SEVERITY_WARNING, "Input/Turbine Speed Sensor Circuit"},     // P0715
+    {0x0720, DTC_SEVERITY_WARNING, "Output Speed Sensor Circuit"},            // P0720
+    {0x0730, DTC_SEVERITY_WARNING, "Incorrect Gear Ratio"},                   // P0730
+    {0x0740, DTC_SEVERITY_WARNING, "Torque Converter Clutch Circuit"},        // P0740
+    {0x0750, DTC_SEVERITY_WARNING, "Shift Solenoid A"},                       // P0750
+    {0x2096, DTC_SEVERITY_WARNING, "Post Catalyst Fuel Trim Too Lean B1"},    // P2096
+    {0x2097, DTC_SEVERITY_WARNING, "Post Catalyst Fuel Trim Too Rich B1"},    // P2097
+    {0x2135, DTC_SEVERITY_WARNING, "Throttle Position Sensor A/B Correlation"},// P2135
+    {0x2177, DTC_SEVERITY_WARNING, "System Too Lean Off Idle B1"},            // P2177
+    {0x2187, DTC_SEVERITY_WARNING, "System Too Lean at Idle B1"},             // P2187
+    {0x2188, DTC_SEVERITY_WARNING, "System Too Rich at Idle B1"},             // P2188
+    {0x2270, DTC_SEVERITY_INFO, "O2 Sensor Signal Stuck Lean B1S2"},          // P2270
+    {0x2271, DTC_SEVERITY_INFO, "O2 Sensor Signal Stuck Rich B1S2"},          // P2271
+    {0x4035, DTC_SEVERITY_WARNING, "Left Front Wheel Speed Sensor"},          // C0035
+    {0x4040, DTC_SEVERITY_WARNING, "Right Front Wheel Speed Sensor"},         // C0040
+    {0x4045, DTC_SEVERITY_WARNING, "Left Rear Wheel Speed Sensor"},           // C0045
+    {0x4050, DTC_SEVERITY_WARNING, "Right Rear Wheel Speed Sensor"},          // C0050
+    {0x4110, DTC_SEVERITY_WARNING, "ABS Pump Motor Circuit"},                 // C0110
+    {0x4242, DTC_SEVERITY_WARNING, "PCM Indicated TCS Malfunction"},          // C0242
+    {0x8001, DTC_SEVERITY_CRITICAL, "Driver Frontal Airbag Stage 1"},         // B0001
+    {0x8002, DTC_SEVERITY_CRITICAL, "Driver Frontal Airbag Stage 2"},         // B0002
+    {0x8010, DTC_SEVERITY_CRITICAL, "Passenger Frontal Airbag Stage 1"},      // B0010
+    {0xC001, DTC_SEVERITY_WARNING, "High Speed CAN Bus"},                     // U0001
+    {0xC073, DTC_SEVERITY_WARNING, "Control Module Comms Bus Off"},           // U0073
+    {0xC100, DTC_SEVERITY_CRITICAL, "Lost Communication With ECM/PCM"},       // U0100
+    {0xC101, DTC_SEVERITY_WARNING, "Lost Communication With TCM"},            // U0101
+    {0xC121, DTC_SEVERITY_WARNING, "Lost Communication With ABS"},            // U0121
+    {0xC140, DTC_SEVERITY_WARNING, "Lost Communication With BCM"},            // U0140
+    {0xC155, DTC_SEVERITY_INFO, "Lost Communication With Cluster"},           // U0155
+};
+
+static constexpr uint16_t dtc_table_size = sizeof(dtc_table) / sizeof(dtc_table[0]);
+
+/**
+ * Check that entries [begin, end) are strictly ascending
+ * (C++11 constexpr: single return statement, recursion)
+ * Halves the range per level - depth log2(n), far below -fconstexpr-depth
+ * even for the full SAE code set
+ */
+static constexpr bool isTableSorted(uint16_t begin, uint16_t end) {
+    return (end - begin < 2) ||
+           (dtc_table[begin + (end - begin) / 2 - 1].raw < dtc_table[begin + (end - begin) / 2].raw &&
+            isTableSorted(begin, begin + (end - begin) / 2) &&
+            isTableSorted(begin + (end - begin) / 2, end));
+}
+
+static_assert(isTableSorted(0, dtc_table_size), "dtc_table must be sorted by raw value without duplicates");
+
+// ============================================================================
+// CODE FORMATTING
+// ============================================================================
+
+void parseDTC(uint16_t dtc_value, char* code) {
+    // Extract parts
+    uint8_t prefix = (dtc_value >> 14) & 0x03;
+    uint8_t digit1 = (dtc_value >> 12) & 0x03;
+    uint8_t digit2 = (dtc_value >> 8) & 0x0F;
+    uint8_t digit3 = (dtc_value >> 4) & 0x0F;
+    uint8_t digit4 = dtc_value & 0x0F;
+
+    // Determine prefix letter
+    char prefix_char;
+    switch (prefix) {
+        case 0: prefix_char = 'P'; break;  // Powertrain
+        case 1: prefix_char = 'C'; break;  // Chassis
+        case 2: prefix_char = 'B'; break;  // Body
+        case 3: prefix_char = 'U'; break;  // Network
+        default: prefix_char = 'P'; break;
+    }
+
+    // Format code
+    snprintf(code, 6, "%c%d%X%X%X", prefix_char, digit1, digit2, digit3, digit4);
+}
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+const DTCInfo* findDTCInfo(uint16_t raw) {
+    uint16_t low = 0;
+    uint16_t high = dtc_table_size;
+
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (dtc_table[mid].raw < raw) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if (low < dtc_table_size && dtc_table[low].raw == raw) {
+        return &dtc_table[low];
+    }
+    return NULL;
+}
+
+/**
+ * Description of the SAE J2012 group a code belongs to
+ */
+static const char* getDTCGroupDescription(uint16_t raw) {
+    uint8_t system = (raw >> 14) & 0x03;
+    uint8_t digit1 = (raw >> 12) & 0x03;
+    uint8_t digit2 = (raw >> 8) & 0x0F;
+
+    switch (system) {
+        case 0:  // Powertrain
+            if (digit1 == 1 || digit1 == 3) return "Manufacturer Powertrain Code";
+            if (digit1 == 2) return "Fuel/Air/Emissions (unlisted code)";
+            switch (digit2) {
+                case 0x0:
+                case 0x1:
+                case 0x2: return "Fuel/Air Metering (unlisted code)";
+                case 0x3: return "Ignition/Misfire (unlisted code)";
+                case 0x4: return "Emission Controls (unlisted code)";
+                case 0x5: return "Speed/Idle Control (unlisted code)";
+                case 0x6: return "Computer/Output Circuit (unlisted code)";
+                case 0x7:
+                case 0x8:
+                case 0x9: return "Transmission (unlisted code)";
+                case 0xA: return "Hybrid Propulsion (unlisted code)";
+                default:  return "Powertrain (unlisted code)";
+            }
+        case 1:  // Chassis
+            return (digit1 == 0 || digit1 == 3) ? "Chassis (unlisted code)" : "Manufacturer Chassis Code";
+        case 2:  // Body
+            return (digit1 == 0 || digit1 == 3) ? "Body (unlisted code)" : "Manufacturer Body Code";
+        default:  // Network
+            return (digit1 == 0 || digit1 == 3) ? "Network Communication (unlisted code)"
+                                                : "Manufacturer Network Code";
+    }
+}
+
+const char* getDTCDescription(uint16_t raw) {
+    const DTCInfo* info = findDTCInfo(raw);
+    return info ? info->description : getDTCGroupDescription(raw);
+}
+
+uint8_t getDTCSeverity(uint16_t raw) {
+    const DTCInfo* info = findDTCInfo(raw);
+    return info ? info->severity : DTC_SEVERITY_INFO;  // Default for unknown codes
+}
+
+uint16_t getDTCTableSize() {
+    return dtc_table_size;
+}
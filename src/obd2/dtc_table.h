@@ -0,0 +1,76 @@
+/**
+ * DTC Table Module
+ *
+ * Flash-resident lookup of DTC descriptions and severities:
+ * - Single constexpr table keyed by the 16-bit raw DTC value
+ * - Sorted by raw value, binary search (O(log n), no RAM)
+ * - Range-based fallback descriptions for codes not in the table
+ * - DTC code formatting (raw value -> "P0133")
+ *
+ * Has no Arduino dependencies
+ */
+
+#ifndef DTC_TABLE_H
+#define DTC_TABLE_H
+
+#include <stdint.h>
+
+// ============================================================================
+// DTC DEFINITIONS
+// ============================================================================
+
+// DTC severity levels
+#define DTC_SEVERITY_INFO       0
+#define DTC_SEVERITY_WARNING    1
+#define DTC_SEVERITY_CRITICAL   2
+
+/**
+ * Table entry (lives in flash)
+ * Raw value layout (SAE J2012): [system:2][digit1:2][digit2:4][digit3:4][digit4:4]
+ * system: 0=P, 1=C, 2=B, 3=U - so P0300 = 0x0300, C0035 = 0x4035, U0100 = 0xC100
+ */
+struct DTCInfo {
+    uint16_t raw;               // Raw 16-bit DTC value as sent by the ECU
+    uint8_t severity;           // 0=info, 1=warning, 2=critical
+    const char* description;    // Human-readable description
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Format raw DTC value as code string
+ * @param dtc_value 2-byte DTC value from ECU
+ * @param code Output buffer (must be at least 6 chars)
+ */
+void parseDTC(uint16_t dtc_value, char* code);
+
+/**
+ * Find table entry for a raw DTC value (binary search)
+ * @param raw Raw DTC value
+ * @return Entry, or NULL if code is not in the table
+ */
+const DTCInfo* findDTCInfo(uint16_t raw);
+
+/**
+ * Get DTC description
+ * Falls back to the SAE group of the code (e.g., "Ignition/Misfire (unlisted code)")
+ * @param raw Raw DTC value
+ * @return Description (static string in flash)
+ */
+const char* getDTCDescription(uint16_t raw);
+
+/**
+ * Get DTC severity level
+ * @param raw Raw DTC value
+ * @return Severity level (0=info, 1=warning, 2=critical), info for unknown codes
+ */
+uint8_t getDTCSeverity(uint16_t raw);
+
+/**
+ * Get number of codes in the table
+ */
+uint16_t getDTCTableSize();
+
+#endif // DTC_TABLE_H
@@ -4,6 +4,7 @@
 
 #include "elm327.h"
 #include "bluetooth.h"
+#include "../metrics/metrics.h"
 
 // ============================================================================
 // GLOBAL OBJECTS
@@ -20,6 +21,22 @@ bool connectToELM327() {
     if (!connectBluetooth()) {
         return false;
     }
+    return initELM327();
+}
+
+bool initELM327() {
+    // Readiness probe instead of a fixed settle delay: the adapter is ready
+    // as soon as it answers a bare CR with its prompt
+    uint32_t start = millis();
+    bool ready = false;
+    while (!ready && millis() - start < ELM327_READY_TIMEOUT_MS) {
+        ready = resyncELM327();
+    }
+    if (ready) {
+        Serial.printf("[ELM] Adapter ready after %lu ms\n", (unsigned long)(millis() - start));
+    } else {
+        Serial.println("WARNING: No adapter prompt yet - trying ELM327 init anyway");
+    }
 
     // Initialize ELM327
     Serial.println("\nInitializing ELM327...");
@@ -32,6 +49,11 @@ bool connectToELM327() {
     }
 
     Serial.println("✓ ELM327 initialized successfully!");
+
+    // Compact replies and short ECU timeouts (raises queries per second)
+    if (!configureELMLink()) {
+        Serial.println("WARNING: ELM327 link tuning incomplete - using adapter defaults");
+    }
     return true;
 }
 
@@ -39,65 +61,159 @@ bool connectToELM327() {
 // OBD2 COMMUNICATION
 // ============================================================================
 
-String sendOBD2Command(String cmd) {
-    // Clear input buffer
-    while (SerialBT.available()) {
-        SerialBT.read();
-    }
+// Reply buffer shared by all query functions (only used from the OBD2 task)
+static ELMResponse rx_response;
 
-    // Send command
-    SerialBT.print(cmd + "\r");
+// Writer-side copy of the cold block for DTC/VIN updates (only used from the OBD2 task)
+static VehicleInfo info_scratch;
 
-    // Wait for response
-    unsigned long start = millis();
-    String response = "";
+/**
+ * Publish info_scratch to readers and wake the display task
+ */
+static void publishVehicleInfo() {
+    vehicle_info.write(info_scratch);
+    xEventGroupSetBits(obd_events, OBD_EVT_VEHICLE_INFO);
+}
 
-    while (millis() - start < 2000) {  // 2 second timeout
-        if (SerialBT.available()) {
-            char c = SerialBT.read();
-            response += c;
+// ============================================================================
+// LINK TUNING
+// ============================================================================
 
-            // Check for end of response ('>')
-            if (c == '>') {
-                break;
-            }
+/**
+ * Send AT command and check for "OK"
+ */
+static bool sendATCommand(const char* cmd) {
+    sendOBD2Command(cmd, rx_response, ELM327_AT_TIMEOUT_MS);
+    bool ok = (rx_response.status != ELM_TIMEOUT) && strstr(rx_response.text, "OK") != NULL;
+    Serial.printf("[ELM] %s -> %s\n", cmd, ok ? "OK" : rx_response.text);
+    return ok;
+}
+
+/**
+ * Read adapter identity (ATI) into buffer, trimmed to the first printable line
+ */
+static void readAdapterIdentity(char* identity, size_t size) {
+    identity[0] = '\0';
+    sendOBD2Command("ATI", rx_response, ELM327_AT_TIMEOUT_MS);
+
+    const char* p = rx_response.text;
+    size_t len = 0;
+    while (*p && len + 1 < size) {
+        char c = *p++;
+        if (c == '\r' || c == '\n') {
+            if (len > 0) break;  // End of first non-empty line
+            continue;
         }
-        delay(1);
+        if (len == 0 && c == ' ') continue;
+        identity[len++] = c;
     }
+    identity[len] = '\0';
+}
+
+/**
+ * Clone detection
+ * - "v1.5" was never released by ELM Electronics (common clone firmware)
+ * - Program parameter summary (ATPPS, v1.1+) is missing on most v2.1 clones
+ */
+static bool detectClone(const char* identity) {
+    if (strstr(identity, "ELM327") == NULL) return true;
+    if (strstr(identity, "v1.5") != NULL) return true;
 
-    return response;
+    sendOBD2Command("ATPPS", rx_response, ELM327_AT_TIMEOUT_MS);
+    return rx_response.status == ELM_TIMEOUT || strchr(rx_response.text, '?') != NULL;
 }
 
-int parseHexByte(String response, int byteIndex) {
-    // Response format: "41 05 A0 >"
-    // "41" = mode response, "05" = PID echo, "A0" = actual data
-    int startPos = response.indexOf("41");
-    if (startPos < 0) return -1;
+bool configureELMLink() {
+    // Formatting: each option removes bytes from every reply
+    bool ok = sendATCommand("ATE0");     // Echo off
+    ok &= sendATCommand("ATL0");         // Linefeeds off (CR only)
+    ok &= sendATCommand("ATS0");         // Spaces off ("410C0FA0")
+    ok &= sendATCommand("ATH0");         // Headers off
+
+    // Identify adapter before choosing timing
+    char identity[sizeof(info_scratch.adapter)];
+    readAdapterIdentity(identity, sizeof(identity));
+    bool clone = detectClone(identity);
+    Serial.printf("[ELM] Adapter: %s%s\n", identity[0] ? identity : "(unknown)",
+                  clone ? " (clone)" : "");
+
+    // Timing: adaptive (stop waiting once the ECU went quiet) + max ECU wait
+    char cmd[8];
+    uint8_t timing = clone ? 1 : ELM327_ADAPTIVE_TIMING;
+    snprintf(cmd, sizeof(cmd), "ATAT%d", timing);
+    if (!sendATCommand(cmd) && timing > 1) {
+        sendATCommand("ATAT1");
+    }
+    snprintf(cmd, sizeof(cmd), "ATST%02X", clone ? ELM327_ST_TIMEOUT_CLONE : ELM327_ST_TIMEOUT);
+    sendATCommand(cmd);
 
-    // Skip "41 XX " (mode response + PID + spaces = 6 characters)
-    String data = response.substring(startPos + 6);
-    data.trim();
+    // Publish adapter info
+    metricsTimedRead(vehicle_info, info_scratch);
+    snprintf(info_scratch.adapter, sizeof(info_scratch.adapter), "%s",
+             identity[0] ? identity : "Unknown");
+    info_scratch.adapter_clone = clone;
+    publishVehicleInfo();
 
-    // Find the nth hex byte
-    int currentByte = 0;
-    int pos = 0;
+    return ok;
+}
 
-    while (pos < data.length() && currentByte <= byteIndex) {
-        // Skip spaces
-        while (pos < data.length() && data[pos] == ' ') pos++;
+// ============================================================================
+// LINK RECOVERY
+// ============================================================================
 
-        if (currentByte == byteIndex) {
-            // Found our byte - parse it
-            String hexByte = data.substring(pos, pos + 2);
-            return strtol(hexByte.c_str(), NULL, 16);
-        }
+bool resyncELM327() {
+    // Bare CR: aborts a command still in flight (or repeats the last one),
+    // either way the adapter ends with a fresh '>' prompt
+    sendOBD2Command("", rx_response, ELM327_RESYNC_TIMEOUT_MS);
+    Serial.printf("[ELM] Prompt resync: %s\n", rx_response.prompt_received ? "OK" : "no prompt");
+    return rx_response.prompt_received;
+}
 
-        // Move to next byte
-        pos += 2;
-        currentByte++;
+bool probeECU(uint32_t timeout_ms) {
+    OBDResponseView view;
+    sendOBD2Command("0100", rx_response, timeout_ms);
+    bool ok = findPIDResponse(rx_response, 0x41, 0x00, view);
+    Serial.printf("[ELM] ECU probe: %s\n", ok ? "OK" : rx_response.text);
+    return ok;
+}
+
+bool warmStartELM327() {
+    // ATWS resets the adapter's protocol state without the ATZ power-on delay
+    sendOBD2Command("ATWS", rx_response, ELM327_AT_TIMEOUT_MS);
+    if (!rx_response.prompt_received) {
+        Serial.println("[ELM] Warm start: no reply");
+        return false;
     }
+    Serial.println("[ELM] Warm start OK");
 
-    return -1;
+    // Warm start restores defaults (echo on, spaces on, ...)
+    configureELMLink();
+    return true;
+}
+
+// ============================================================================
+// COMMAND TRANSPORT
+// ============================================================================
+
+bool sendOBD2Command(const char* cmd, ELMResponse& resp, uint32_t timeout_ms) {
+    // Queued behind any poll already on the wire, then copied out of the slot
+    int8_t slot = elmSubmit(cmd, timeout_ms);
+    resp = elmAwait(slot).resp;
+    elmRelease(slot);
+    return resp.status != ELM_TIMEOUT;
+}
+
+/**
+ * Send single-PID Mode 01 request and get view of its data bytes
+ * @return true if the ECU answered with at least getPIDDataLength(pid) bytes
+ */
+static bool queryPIDData(uint8_t pid, OBDResponseView& view) {
+    char cmd[5];
+    snprintf(cmd, sizeof(cmd), "01%02X", pid);
+
+    sendOBD2Command(cmd, rx_response);
+    return findPIDResponse(rx_response, 0x41, pid, view) &&
+           view.payload_len >= getPIDDataLength(pid);
 }
 
 // ============================================================================
@@ -105,315 +221,448 @@ int parseHexByte(String response, int byteIndex) {
 // ============================================================================
 
 int queryRPM() {
-    String response = sendOBD2Command("010C");
-    int A = parseHexByte(response, 0);
-    int B = parseHexByte(response, 1);
-
-    if (A >= 0 && B >= 0) {
-        return ((A * 256) + B) / 4;
+    OBDResponseView view;
+    if (queryPIDData(PID_RPM, view)) {
+        return decodePIDValue(PID_RPM, view.payload);
     }
     return -1;
 }
 
 int querySpeed() {
-    String response = sendOBD2Command("010D");
-    int A = parseHexByte(response, 0);
-    return A;
+    OBDResponseView view;
+    if (queryPIDData(PID_SPEED, view)) {
+        return decodePIDValue(PID_SPEED, view.payload);
+    }
+    return -1;
 }
 
 float queryCoolantTemp() {
-    String response = sendOBD2Command("0105");
-    int A = parseHexByte(response, 0);
-
-    if (A >= 0) {
-        return A - 40.0;
+    OBDResponseView view;
+    if (queryPIDData(PID_COOLANT_TEMP, view)) {
+        return decodePIDValue(PID_COOLANT_TEMP, view.payload);
     }
     return -999;
 }
 
 float queryThrottle() {
-    String response = sendOBD2Command("0111");
-    int A = parseHexByte(response, 0);
-
-    if (A >= 0) {
-        return (A * 100.0) / 255.0;
+    OBDResponseView view;
+    if (queryPIDData(PID_THROTTLE, view)) {
+        return decodePIDValue(PID_THROTTLE, view.payload);
     }
     return -1;
 }
 
 float queryIntakeTemp() {
-    String response = sendOBD2Command("010F");
-    int A = parseHexByte(response, 0);
-
-    if (A >= 0) {
-        return A - 40.0;
+    OBDResponseView view;
+    if (queryPIDData(PID_INTAKE_TEMP, view)) {
+        return decodePIDValue(PID_INTAKE_TEMP, view.payload);
     }
     return -999;
 }
 
 float queryBatteryVoltage() {
-    String response = sendOBD2Command("0142");
-    int A = parseHexByte(response, 0);
-    int B = parseHexByte(response, 1);
-
-    if (A >= 0 && B >= 0) {
-        return ((A * 256) + B) / 1000.0;
+    OBDResponseView view;
+    if (queryPIDData(PID_BATTERY_VOLTAGE, view)) {
+        return decodePIDValue(PID_BATTERY_VOLTAGE, view.payload);
     }
     return -1;
 }
 
 // ============================================================================
-// DTC FUNCTIONS
+// BATCHED PID QUERIES
 // ============================================================================
 
-void parseDTC(uint16_t dtc_value, char* code) {
-    // Extract parts
-    uint8_t prefix = (dtc_value >> 14) & 0x03;
-    uint8_t digit1 = (dtc_value >> 12) & 0x03;
-    uint8_t digit2 = (dtc_value >> 8) & 0x0F;
-    uint8_t digit3 = (dtc_value >> 4) & 0x0F;
-    uint8_t digit4 = dtc_value & 0x0F;
-
-    // Determine prefix letter
-    char prefix_char;
-    switch (prefix) {
-        case 0: prefix_char = 'P'; break;  // Powertrain
-        case 1: prefix_char = 'C'; break;  // Chassis
-        case 2: prefix_char = 'B'; break;  // Body
-        case 3: prefix_char = 'U'; break;  // Network
-        default: prefix_char = 'P'; break;
-    }
-
-    // Format code
-    snprintf(code, 6, "%c%d%X%X%X", prefix_char, digit1, digit2, digit3, digit4);
-}
-
-const char* getDTCDescription(const char* code) {
-    // Critical codes - Engine damage risk
-    if (strcmp(code, "P0300") == 0) return "Random Misfire Detected";
-    if (strcmp(code, "P0301") == 0) return "Cylinder 1 Misfire";
-    if (strcmp(code, "P0302") == 0) return "Cylinder 2 Misfire";
-    if (strcmp(code, "P0303") == 0) return "Cylinder 3 Misfire";
-    if (strcmp(code, "P0304") == 0) return "Cylinder 4 Misfire";
-    if (strcmp(code, "P0217") == 0) return "Engine Overheat Condition";
-    if (strcmp(code, "P0218") == 0) return "Transmission Overheat";
-    if (strcmp(code, "P0524") == 0) return "Engine Oil Pressure Too Low";
-    if (strcmp(code, "P0522") == 0) return "Oil Pressure Sensor Low";
-    if (strcmp(code, "P0523") == 0) return "Oil Pressure Sensor High";
-    if (strcmp(code, "P0016") == 0) return "Crankshaft/Camshaft Correlation";
-    if (strcmp(code, "P0017") == 0) return "Crankshaft/Camshaft Correlation B1";
-    if (strcmp(code, "P0335") == 0) return "Crankshaft Position Sensor";
-    if (strcmp(code, "P0340") == 0) return "Camshaft Position Sensor";
-    
-    // Warning codes - Performance/Emissions
-    if (strcmp(code, "P0420") == 0) return "Catalyst Efficiency Low B1";
-    if (strcmp(code, "P0430") == 0) return "Catalyst Efficiency Low B2";
-    if (strcmp(code, "P0171") == 0) return "System Too Lean B1";
-    if (strcmp(code, "P0172") == 0) return "System Too Rich B1";
-    if (strcmp(code, "P0174") == 0) return "System Too Lean B2";
-    if (strcmp(code, "P0175") == 0) return "System Too Rich B2";
-    if (strcmp(code, "P0440") == 0) return "EVAP System Malfunction";
-    if (strcmp(code, "P0442") == 0) return "EVAP System Small Leak";
-    if (strcmp(code, "P0455") == 0) return "EVAP System Large Leak";
-    if (strcmp(code, "P0456") == 0) return "EVAP System Very Small Leak";
-    if (strcmp(code, "P0128") == 0) return "Coolant Thermostat Malfunction";
-    if (strcmp(code, "P0133") == 0) return "O2 Sensor Slow Response B1S1";
-    if (strcmp(code, "P0134") == 0) return "O2 Sensor No Activity B1S1";
-    if (strcmp(code, "P0135") == 0) return "O2 Sensor Heater B1S1";
-    if (strcmp(code, "P0141") == 0) return "O2 Sensor Heater B1S2";
-    if (strcmp(code, "P0401") == 0) return "EGR Insufficient Flow";
-    if (strcmp(code, "P0402") == 0) return "EGR Excessive Flow";
-    if (strcmp(code, "P0411") == 0) return "Secondary Air Injection";
-    if (strcmp(code, "P0606") == 0) return "ECM Processor Fault";
-    if (strcmp(code, "P0244") == 0) return "Wastegate Solenoid";
-    
-    // Info codes - Sensor issues
-    if (strcmp(code, "P0101") == 0) return "MAF Sensor Range/Performance";
-    if (strcmp(code, "P0102") == 0) return "MAF Sensor Circuit Low";
-    if (strcmp(code, "P0103") == 0) return "MAF Sensor Circuit High";
-    if (strcmp(code, "P0106") == 0) return "MAP Sensor Range/Performance";
-    if (strcmp(code, "P0107") == 0) return "MAP Sensor Circuit Low";
-    if (strcmp(code, "P0108") == 0) return "MAP Sensor Circuit High";
-    if (strcmp(code, "P0112") == 0) return "Intake Air Temp Sensor Low";
-    if (strcmp(code, "P0113") == 0) return "Intake Air Temp Sensor High";
-    if (strcmp(code, "P0116") == 0) return "Coolant Temp Sensor Range";
-    if (strcmp(code, "P0117") == 0) return "Coolant Temp Sensor Low";
-    if (strcmp(code, "P0118") == 0) return "Coolant Temp Sensor High";
-    if (strcmp(code, "P0122") == 0) return "Throttle Position Sensor Low";
-    if (strcmp(code, "P0123") == 0) return "Throttle Position Sensor High";
-    if (strcmp(code, "P0562") == 0) return "System Voltage Low";
-    if (strcmp(code, "P0563") == 0) return "System Voltage High";
-
-    return "Unknown DTC";
-}
-
-uint8_t getDTCSeverity(const char* code) {
-    // Critical codes (engine damage risk)
-    if (strcmp(code, "P0300") == 0) return DTC_SEVERITY_CRITICAL;  // Random misfire
-    if (strcmp(code, "P0301") == 0) return DTC_SEVERITY_CRITICAL;  // Cylinder 1 misfire
-    if (strcmp(code, "P0302") == 0) return DTC_SEVERITY_CRITICAL;  // Cylinder 2 misfire
-    if (strcmp(code, "P0303") == 0) return DTC_SEVERITY_CRITICAL;  // Cylinder 3 misfire
-    if (strcmp(code, "P0304") == 0) return DTC_SEVERITY_CRITICAL;  // Cylinder 4 misfire
-    if (strcmp(code, "P0217") == 0) return DTC_SEVERITY_CRITICAL;  // Engine overheating
-    if (strcmp(code, "P0218") == 0) return DTC_SEVERITY_CRITICAL;  // Transmission overheating
-    if (strcmp(code, "P0524") == 0) return DTC_SEVERITY_CRITICAL;  // Oil pressure too low
-    if (strcmp(code, "P0522") == 0) return DTC_SEVERITY_CRITICAL;  // Oil pressure sensor low
-    if (strcmp(code, "P0523") == 0) return DTC_SEVERITY_CRITICAL;  // Oil pressure sensor high
-    if (strcmp(code, "P0016") == 0) return DTC_SEVERITY_CRITICAL;  // Cam/Crank correlation
-    if (strcmp(code, "P0017") == 0) return DTC_SEVERITY_CRITICAL;  // Cam/Crank correlation Bank 1
-    if (strcmp(code, "P0335") == 0) return DTC_SEVERITY_CRITICAL;  // Crankshaft position sensor
-    if (strcmp(code, "P0340") == 0) return DTC_SEVERITY_CRITICAL;  // Camshaft position sensor
-    
-    // Warning codes (performance/emissions)
-    if (strcmp(code, "P0420") == 0) return DTC_SEVERITY_WARNING;   // Catalyst efficiency
-    if (strcmp(code, "P0430") == 0) return DTC_SEVERITY_WARNING;   // Catalyst efficiency Bank 2
-    if (strcmp(code, "P0171") == 0) return DTC_SEVERITY_WARNING;   // System too lean Bank 1
-    if (strcmp(code, "P0172") == 0) return DTC_SEVERITY_WARNING;   // System too rich Bank 1
-    if (strcmp(code, "P0174") == 0) return DTC_SEVERITY_WARNING;   // System too lean Bank 2
-    if (strcmp(code, "P0175") == 0) return DTC_SEVERITY_WARNING;   // System too rich Bank 2
-    if (strcmp(code, "P0440") == 0) return DTC_SEVERITY_WARNING;   // EVAP system
-    if (strcmp(code, "P0442") == 0) return DTC_SEVERITY_WARNING;   // EVAP leak small
-    if (strcmp(code, "P0455") == 0) return DTC_SEVERITY_WARNING;   // EVAP leak large
-    if (strcmp(code, "P0456") == 0) return DTC_SEVERITY_WARNING;   // EVAP leak very small
-    if (strcmp(code, "P0128") == 0) return DTC_SEVERITY_WARNING;   // Coolant thermostat
-    if (strcmp(code, "P0133") == 0) return DTC_SEVERITY_WARNING;   // O2 sensor slow response
-    if (strcmp(code, "P0134") == 0) return DTC_SEVERITY_WARNING;   // O2 sensor no activity
-    if (strcmp(code, "P0135") == 0) return DTC_SEVERITY_WARNING;   // O2 sensor heater
-    if (strcmp(code, "P0141") == 0) return DTC_SEVERITY_WARNING;   // O2 sensor heater Bank 1 Sensor 2
-    if (strcmp(code, "P0401") == 0) return DTC_SEVERITY_WARNING;   // EGR insufficient flow
-    if (strcmp(code, "P0402") == 0) return DTC_SEVERITY_WARNING;   // EGR excessive flow
-    if (strcmp(code, "P0411") == 0) return DTC_SEVERITY_WARNING;   // Secondary air injection
-    if (strcmp(code, "P0606") == 0) return DTC_SEVERITY_WARNING;   // ECM processor fault
-    
-    return DTC_SEVERITY_INFO;  // Default for unknown codes
-}
-
-void sortDTCsBySeverity() {
-    // Need to access global obd_data - include obd_data.h
-    extern OBDData obd_data;
-    extern SemaphoreHandle_t data_mutex;
-
-    // Simple bubble sort by severity (critical = 2, warning = 1, info = 0)
-    for (int i = 0; i < obd_data.dtc_count - 1; i++) {
-        for (int j = 0; j < obd_data.dtc_count - i - 1; j++) {
-            if (obd_data.dtc_codes[j].severity < obd_data.dtc_codes[j + 1].severity) {
-                // Swap
-                DTC temp = obd_data.dtc_codes[j];
-                obd_data.dtc_codes[j] = obd_data.dtc_codes[j + 1];
-                obd_data.dtc_codes[j + 1] = temp;
+bool submitPIDPoll(const uint8_t* pids, uint8_t count, PIDPoll& poll, bool repeatable) {
+    if (count == 0) return false;
+    if (count > OBD2_MAX_PIDS_PER_REQUEST) {
+        count = OBD2_MAX_PIDS_PER_REQUEST;
+    }
+
+    // Build request: "01" + PID list (e.g., "010C0D05110F42")
+    char cmd[3 + OBD2_MAX_PIDS_PER_REQUEST * 2];
+    strcpy(cmd, "01");
+    for (uint8_t i = 0; i < count; i++) {
+        snprintf(cmd + 2 + i * 2, 3, "%02X", pids[i]);
+        poll.pids[i] = pids[i];
+    }
+    poll.count = count;
+    poll.rtt_ms = 0;
+    poll.start_ms = millis();
+    poll.slot = elmSubmit(cmd, ELM327_TIMEOUT_MS, repeatable);
+    return true;
+}
+
+void waitPIDPoll(PIDPoll& poll) {
+    poll.rtt_ms = elmAwait(poll.slot).rtt_ms;
+}
+
+int finishPIDPoll(PIDPoll& poll, PIDReading* readings) {
+    const ELMResponse& resp = elmAwait(poll.slot).resp;
+    int decoded = 0;
+
+    for (uint8_t i = 0; i < poll.count; i++) {
+        readings[i].pid = poll.pids[i];
+        readings[i].valid = false;
+    }
+
+    if (resp.status == ELM_TIMEOUT) {
+        decoded = 0;  // Timeout - link problem, not a rejection
+    } else if (poll.count == 1) {
+        // Single-PID request: NO DATA is a plain failure, never a rejection
+        OBDResponseView view;
+        uint8_t pid = poll.pids[0];
+        if (findPIDResponse(resp, 0x41, pid, view) && view.payload_len >= getPIDDataLength(pid)) {
+            memcpy(readings[0].data, view.payload, getPIDDataLength(pid));
+            readings[0].valid = true;
+            decoded = 1;
+        }
+    } else {
+        // Complete reply without any PID data means the request was rejected
+        decoded = decodeMultiPIDResponse(resp, poll.pids, poll.count, readings);
+    }
+
+    poll.rtt_ms = elmAwait(poll.slot).rtt_ms;
+    elmRelease(poll.slot);
+    poll.slot = -1;
+    return decoded;
+}
+
+void discardPIDPoll(PIDPoll& poll) {
+    elmRelease(poll.slot);
+    poll.slot = -1;
+}
+
+int queryPIDsBatched(const uint8_t* pids, uint8_t count, PIDReading* readings) {
+    PIDPoll poll;
+    if (!submitPIDPoll(pids, count, poll)) return 0;
+    return finishPIDPoll(poll, readings);
+}
+
+bool queryPIDRaw(uint8_t pid, PIDReading& reading) {
+    PIDPoll poll;
+    submitPIDPoll(&pid, 1, poll);
+    return finishPIDPoll(poll, &reading) == 1;
+}
+
+bool querySupportedPIDs(SupportedPIDs& support) {
+    memset(&support, 0, sizeof(support));
+
+    // Bit 0 of each bitmap announces the next range (PID 0x20, 0x40)
+    for (uint8_t range = 0; range < PID_SUPPORT_RANGES; range++) {
+        char cmd[5];
+        uint8_t range_pid = range * 0x20;
+        snprintf(cmd, sizeof(cmd), "01%02X", range_pid);
+
+        sendOBD2Command(cmd, rx_response);
+        if (!decodeSupportedPIDResponse(rx_response, range_pid, support.ranges[range])) {
+            // Announced but no answer - ranges from here on stay unknown (polled)
+            if (range > 0) {
+                Serial.printf("[PIDs] %s failed - PIDs above 0x%02X polled unchecked, not cached\n",
+                              cmd, range_pid);
             }
+            return support.valid;
+        }
+        support.valid = true;
+        support.probed_ranges = range + 1;
+
+        Serial.printf("[PIDs] %s -> %08lX\n", cmd, (unsigned long)support.ranges[range]);
+        if ((support.ranges[range] & 1) == 0) {
+            // Next ranges not announced: known empty
+            support.probed_ranges = PID_SUPPORT_RANGES;
+            break;
         }
     }
+
+    support.complete = true;
+    return true;
 }
 
-void queryDTCs() {
-    extern OBDData obd_data;
-    extern SemaphoreHandle_t data_mutex;
+// ============================================================================
+// DTC FUNCTIONS
+// ============================================================================
 
-    Serial.println("[DTC] Querying diagnostic trouble codes...");
+// DTC list is assembled here, outside the published block, then copied once
+static DTC dtc_scratch[MAX_DTC_CODES];
+static uint16_t dtc_raw_scratch[MAX_DTC_CODES];
 
-    // Send Mode 03 command
-    String response = sendOBD2Command("03");
+// Codes and status the published freeze frames were read for (OBD2 task only)
+static uint16_t freeze_set_raw[MAX_DTC_CODES];
+static uint8_t freeze_set_status[MAX_DTC_CODES];
+static uint8_t freeze_set_count = 0;
+static bool freeze_set_valid = false;   // No frames read since boot
 
-    Serial.printf("[DTC] Response: %s\n", response.c_str());
+// Several PID/frame pairs per Mode 02 request (cleared once the ECU rejects them, until reboot)
+static bool freeze_batch_supported = true;
 
-    // Parse response
-    // Response format: "43 [count] [DTC1_H] [DTC1_L] [DTC2_H] [DTC2_L] ..."
-    int startPos = response.indexOf("43");
-    if (startPos < 0) {
-        Serial.println("[DTC] No DTCs found or invalid response");
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        obd_data.dtc_count = 0;
-        obd_data.dtc_fetched = true;
-        xSemaphoreGive(data_mutex);
-        return;
+/**
+ * Ordering used for the DTC list: severity first, then stored before
+ * pending/permanent-only codes, then code value
+ */
+static bool dtcBefore(const DTC& a, const DTC& b) {
+    if (a.severity != b.severity) return a.severity > b.severity;
+    bool a_stored = (a.status & DTC_STATUS_STORED) != 0;
+    bool b_stored = (b.status & DTC_STATUS_STORED) != 0;
+    if (a_stored != b_stored) return a_stored;
+    return a.raw < b.raw;
+}
+
+void sortDTCsBySeverity(DTC* codes, uint8_t count) {
+    // Insertion sort - list is short and mostly ordered by the ECU already
+    for (int i = 1; i < count; i++) {
+        DTC current = codes[i];
+        int j = i - 1;
+        while (j >= 0 && dtcBefore(current, codes[j])) {
+            codes[j + 1] = codes[j];
+            j--;
+        }
+        codes[j + 1] = current;
+    }
+}
+
+/**
+ * Read one DTC mode and merge its codes into dtc_scratch
+ * Codes reported by several modes (or several ECUs) are kept once with combined status
+ * @param cmd Request ("03", "07" or "0A")
+ * @param response_mode Expected response mode byte (0x43, 0x47 or 0x4A)
+ * @param status DTC_STATUS_* flag for codes of this mode
+ * @param count In/out: number of codes in dtc_scratch
+ * @return true if the ECU answered (with or without codes)
+ */
+static bool readDTCMode(const char* cmd, uint8_t response_mode, uint8_t status, uint8_t& count) {
+    if (!sendOBD2Command(cmd, rx_response)) {
+        Serial.printf("[DTC] Mode %s: timeout\n", cmd);
+        return false;
+    }
+
+    int found = decodeDTCResponse(rx_response, response_mode, dtc_raw_scratch, MAX_DTC_CODES);
+    if (found < 0) {
+        // NO DATA or negative response (e.g. Mode 0A unsupported on older ECUs)
+        Serial.printf("[DTC] Mode %s: no codes (%s)\n", cmd, rx_response.text);
+        return rx_response.status != ELM_ERROR;
+    }
+
+    for (int i = 0; i < found; i++) {
+        uint16_t raw = dtc_raw_scratch[i];
+
+        // Merge with code already reported by another mode/ECU
+        int existing = -1;
+        for (int j = 0; j < count; j++) {
+            if (dtc_scratch[j].raw == raw) {
+                existing = j;
+                break;
+            }
+        }
+        if (existing >= 0) {
+            dtc_scratch[existing].status |= status;
+            continue;
+        }
+
+        if (count >= MAX_DTC_CODES) {
+            Serial.printf("[DTC] List full (%d) - dropping further codes\n", MAX_DTC_CODES);
+            break;
+        }
+
+        // Parse DTC code, description and severity from flash table
+        DTC& dtc = dtc_scratch[count++];
+        dtc.raw = raw;
+        parseDTC(raw, dtc.code);
+        dtc.description = getDTCDescription(raw);
+        dtc.severity = getDTCSeverity(raw);
+        dtc.status = status;
+    }
+
+    Serial.printf("[DTC] Mode %s: %d code(s)\n", cmd, found);
+    return true;
+}
+
+// ============================================================================
+// FREEZE FRAMES (Mode 02)
+// ============================================================================
+
+/**
+ * Whether the DTC set differs from the one the freeze frames were read for
+ * (a code that turns from pending to stored may have stored a frame)
+ */
+static bool freezeSetChanged(const DTC* codes, uint8_t count) {
+    if (!freeze_set_valid || count != freeze_set_count) return true;
+
+    for (uint8_t i = 0; i < count; i++) {
+        bool found = false;
+        for (uint8_t j = 0; j < freeze_set_count && !found; j++) {
+            found = freeze_set_raw[j] == codes[i].raw && freeze_set_status[j] == codes[i].status;
+        }
+        if (!found) return true;
     }
+    return false;
+}
 
-    // Skip "43 " to get to data
-    String data = response.substring(startPos + 3);
-    data.trim();
+static void rememberFreezeSet(const DTC* codes, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        freeze_set_raw[i] = codes[i].raw;
+        freeze_set_status[i] = codes[i].status;
+    }
+    freeze_set_count = count;
+    freeze_set_valid = true;
+}
 
-    // Parse hex bytes
-    int dtc_index = 0;
-    int pos = 0;
+/**
+ * Request PID/frame pairs with one Mode 02 message
+ * @return Number of PIDs decoded, 0 on timeout, -1 without freeze-frame data
+ */
+static int requestFreezeFramePIDs(uint8_t frame, const uint8_t* pids, uint8_t count,
+                                  PIDReading* readings) {
+    char cmd[3 + 4 * FREEZE_FRAME_PAIRS_PER_REQUEST] = "02";
+    for (uint8_t i = 0; i < count; i++) {
+        snprintf(cmd + 2 + i * 4, 5, "%02X%02X", pids[i], frame);
+    }
 
-    xSemaphoreTake(data_mutex, portMAX_DELAY);
+    if (!sendOBD2Command(cmd, rx_response)) {
+        Serial.printf("[DTC] Freeze frame %s: timeout\n", cmd);
+        return 0;
+    }
+    return decodeFreezeFrameResponse(rx_response, frame, pids, count, readings);
+}
 
-    while (pos < data.length() && dtc_index < 12) {
-        // Skip spaces
-        while (pos < data.length() && data[pos] == ' ') pos++;
-        if (pos >= data.length()) break;
+/**
+ * Read one freeze frame, FREEZE_FRAME_PAIRS_PER_REQUEST pairs per request
+ * Falls back to one pair per request if the ECU rejects several, and keeps
+ * single pairs for later reads once the single requests answered
+ * @param frame Mode 02 frame number
+ * @param out Frame (dtc_raw 0 if the ECU stored none)
+ * @param timed_out Set if a request got no reply (result says nothing about the ECU)
+ * @return true if the ECU stored this frame
+ */
+static bool readFreezeFrame(uint8_t frame, FreezeFrame& out, bool& timed_out) {
+    // PID 02 first: the code that stored the frame (0000 = no frame)
+    uint8_t pids[1 + FREEZE_FRAME_PID_COUNT];
+    PIDReading readings[1 + FREEZE_FRAME_PID_COUNT];
+    const uint8_t total = 1 + FREEZE_FRAME_PID_COUNT;
+    pids[0] = PID_FREEZE_DTC;
+    memcpy(&pids[1], freeze_frame_pids, FREEZE_FRAME_PID_COUNT);
+
+    uint8_t count = 0;
+    for (uint8_t start = 0; start < total; start += count) {
+        uint8_t pairs = freeze_batch_supported ? FREEZE_FRAME_PAIRS_PER_REQUEST : 1;
+        count = min((int)pairs, total - start);
+        int decoded = requestFreezeFramePIDs(frame, &pids[start], count, &readings[start]);
+        if (decoded < 0 && count > 1) {
+            bool singles_answered = false;
+            for (uint8_t i = start; i < start + count && !timed_out; i++) {
+                int single = requestFreezeFramePIDs(frame, &pids[i], 1, &readings[i]);
+                timed_out |= single == 0;
+                singles_answered |= single > 0;
+                if (i == 0 && !readings[0].valid) break;  // No frame stored - skip the signals
+            }
+            if (singles_answered) {
+                Serial.println("[DTC] ECU rejected multi-PID Mode 02 request - one pair per request from now on");
+                freeze_batch_supported = false;
+            }
+        }
+        timed_out |= decoded == 0;
+        if (timed_out) return false;
 
-        // Read high byte
-        String high_byte_str = data.substring(pos, pos + 2);
-        pos += 2;
-        while (pos < data.length() && data[pos] == ' ') pos++;
-        if (pos >= data.length()) break;
+        if (start == 0) {
+            out.dtc_raw = readings[0].valid ? (readings[0].data[0] << 8) | readings[0].data[1] : 0;
+            if (out.dtc_raw == 0) return false;
+        }
+    }
 
-        // Read low byte
-        String low_byte_str = data.substring(pos, pos + 2);
-        pos += 2;
+    out.frame = frame;
+    out.valid_mask = 0;
+    for (uint8_t i = 0; i < FREEZE_FRAME_PID_COUNT; i++) {
+        const PIDReading& reading = readings[1 + i];
+        out.values[i] = reading.valid ? decodePIDValue(reading.pid, reading.data) : 0;
+        if (reading.valid) out.valid_mask |= 1 << i;
+    }
+    return true;
+}
 
-        // Convert to DTC value
-        uint8_t high_byte = strtol(high_byte_str.c_str(), NULL, 16);
-        uint8_t low_byte = strtol(low_byte_str.c_str(), NULL, 16);
-        uint16_t dtc_value = (high_byte << 8) | low_byte;
+/**
+ * Read the freeze frames of the current DTC list into info_scratch
+ * Frames of codes not in the list are dropped (cleared meanwhile)
+ * @return false if the link timed out (frames are read again with the next query)
+ */
+static bool readFreezeFrames(const DTC* codes, uint8_t count) {
+    bool timed_out = false;
+    info_scratch.freeze_frame_count = 0;
 
-        // Skip if 0x0000 (no more DTCs)
-        if (dtc_value == 0x0000) break;
+    for (uint8_t frame = 0; frame < FREEZE_FRAME_MAX_FRAMES && count > 0; frame++) {
+        FreezeFrame& ff = info_scratch.freeze_frames[info_scratch.freeze_frame_count];
+        if (!readFreezeFrame(frame, ff, timed_out)) break;  // Frames are stored in order
 
-        // Parse DTC code
-        parseDTC(dtc_value, obd_data.dtc_codes[dtc_index].code);
+        bool listed = false;
+        for (uint8_t i = 0; i < count && !listed; i++) {
+            listed = codes[i].raw == ff.dtc_raw;
+        }
+        char code[6];
+        parseDTC(ff.dtc_raw, code);
+        Serial.printf("[DTC] Freeze frame %d: %s (%d of %d signals)%s\n", frame, code,
+                      __builtin_popcount(ff.valid_mask), (int)FREEZE_FRAME_PID_COUNT,
+                      listed ? "" : " - code not listed, dropped");
+        if (listed) info_scratch.freeze_frame_count++;
+    }
+    return !timed_out;
+}
 
-        // Get description and severity
-        const char* desc = getDTCDescription(obd_data.dtc_codes[dtc_index].code);
-        strncpy(obd_data.dtc_codes[dtc_index].description, desc, 79);
-        obd_data.dtc_codes[dtc_index].description[79] = '\0';
-        obd_data.dtc_codes[dtc_index].severity = getDTCSeverity(obd_data.dtc_codes[dtc_index].code);
+void queryDTCs() {
+    Serial.println("[DTC] Querying diagnostic trouble codes...");
 
-        Serial.printf("[DTC] Found: %s - %s (severity=%d)\n",
-                      obd_data.dtc_codes[dtc_index].code,
-                      obd_data.dtc_codes[dtc_index].description,
-                      obd_data.dtc_codes[dtc_index].severity);
+    // Fetch and decode all modes into the local list (nothing published yet)
+    uint8_t count = 0;
+    bool answered = false;
+    answered |= readDTCMode("03", 0x43, DTC_STATUS_STORED, count);
+    answered |= readDTCMode("07", 0x47, DTC_STATUS_PENDING, count);
+    answered |= readDTCMode("0A", 0x4A, DTC_STATUS_PERMANENT, count);
 
-        dtc_index++;
+    if (!answered) {
+        // Link problem - keep the previously published list
+        Serial.println("[DTC] No reply from ECU - keeping previous list");
+        return;
     }
 
-    obd_data.dtc_count = dtc_index;
-    obd_data.dtc_fetched = true;
+    sortDTCsBySeverity(dtc_scratch, count);
 
-    xSemaphoreGive(data_mutex);
+    for (int i = 0; i < count; i++) {
+        const DTC& dtc = dtc_scratch[i];
+        Serial.printf("[DTC] Found: %s - %s (severity=%d, status=0x%02X)\n",
+                      dtc.code, dtc.description, dtc.severity, dtc.status);
+    }
 
-    // Sort by severity
-    if (obd_data.dtc_count > 0) {
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        sortDTCsBySeverity();
-        xSemaphoreGive(data_mutex);
+    // Single publish of the finished list (this task is the only writer)
+    metricsTimedRead(vehicle_info, info_scratch);
+    memcpy(info_scratch.dtc_codes, dtc_scratch, count * sizeof(DTC));
+    info_scratch.dtc_count = count;
+    info_scratch.dtc_fetched = true;
+
+    // Freeze frames only when the set changed - a plain refresh costs no extra bus time
+    if (freezeSetChanged(dtc_scratch, count) && readFreezeFrames(dtc_scratch, count)) {
+        rememberFreezeSet(dtc_scratch, count);
     }
+    publishVehicleInfo();
 
-    Serial.printf("[DTC] Total DTCs found: %d\n", obd_data.dtc_count);
+    Serial.printf("[DTC] Total DTCs found: %d\n", count);
 }
 
 bool clearAllDTCs() {
-    extern OBDData obd_data;
-    extern SemaphoreHandle_t data_mutex;
-
     Serial.println("[DTC] Clearing all DTCs from ECU...");
 
     // Send Mode 04 command
-    String response = sendOBD2Command("04");
+    sendOBD2Command("04", rx_response);
 
-    Serial.printf("[DTC] Clear response: %s\n", response.c_str());
+    Serial.printf("[DTC] Clear response: %s\n", rx_response.text);
 
     // Check for positive response (44 = Mode 04 response)
-    if (response.indexOf("44") >= 0) {
+    OBDResponseView view;
+    if (findModeResponse(rx_response, 0x44, view)) {
         Serial.println("[DTC] DTCs cleared successfully from ECU");
 
-        // Clear local DTC list
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        obd_data.dtc_count = 0;
-        obd_data.dtc_fetched = true;
-        xSemaphoreGive(data_mutex);
+        // Clear local DTC list (Mode 04 erases the freeze frames too)
+        metricsTimedRead(vehicle_info, info_scratch);
+        info_scratch.dtc_count = 0;
+        info_scratch.dtc_fetched = true;
+        info_scratch.freeze_frame_count = 0;
+        rememberFreezeSet(dtc_scratch, 0);
+        publishVehicleInfo();
 
         return true;
     } else {
@@ -427,32 +676,27 @@ bool clearAllDTCs() {
 // ============================================================================
 
 void queryVIN() {
-    extern OBDData obd_data;
-    extern SemaphoreHandle_t data_mutex;
-
     Serial.println("[VIN] Querying Vehicle Identification Number...");
 
     // Send Mode 09, PID 02 command
-    String response = sendOBD2Command("0902");
+    sendOBD2Command("0902", rx_response);
 
-    Serial.printf("[VIN] Response: %s\n", response.c_str());
+    Serial.printf("[VIN] Response: %s\n", rx_response.text);
 
     // Parse VIN from response
     // Response format: "49 02 01 [VIN bytes in ASCII]"
     // VIN is 17 characters long
-    if (response.indexOf("49 02") >= 0 || response.indexOf("4902") >= 0) {
-        // Remove spaces and mode/PID prefix
-        response.replace(" ", "");
-        response.replace("4902", "");
-        response.replace("01", "");  // Remove line counter if present
+    metricsTimedRead(vehicle_info, info_scratch);
+    info_scratch.vin_cached = false;
 
-        // Extract VIN (next 34 hex chars = 17 ASCII chars)
+    OBDResponseView view;
+    if (findPIDResponse(rx_response, 0x49, 0x02, view)) {
+        // Extract VIN (17 ASCII bytes after the data item counter)
         char vin[18] = {0};
         int vin_idx = 0;
 
-        for (int i = 0; i < response.length() - 1 && vin_idx < 17; i += 2) {
-            char hex[3] = {response[i], response[i+1], '\0'};
-            int ascii_val = strtol(hex, NULL, 16);
+        for (int i = 0; i < view.payload_len && vin_idx < 17; i++) {
+            uint8_t ascii_val = view.payload[i];
 
             // Only accept printable ASCII characters (0x20-0x7E)
             if (ascii_val >= 0x20 && ascii_val <= 0x7E) {
@@ -464,23 +708,19 @@ void queryVIN() {
         if (vin_idx == 17) {
             Serial.printf("[VIN] Successfully retrieved: %s\n", vin);
 
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            strncpy(obd_data.vin, vin, sizeof(obd_data.vin) - 1);
-            obd_data.vin[17] = '\0';
-            obd_data.vin_fetched = true;
-            xSemaphoreGive(data_mutex);
+            strncpy(info_scratch.vin, vin, sizeof(info_scratch.vin) - 1);
+            info_scratch.vin[17] = '\0';
+            info_scratch.vin_fetched = true;
         } else {
             Serial.printf("[VIN] Invalid VIN length: %d (expected 17)\n", vin_idx);
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            strcpy(obd_data.vin, "Not Available");
-            obd_data.vin_fetched = false;
-            xSemaphoreGive(data_mutex);
+            strcpy(info_scratch.vin, "Not Available");
+            info_scratch.vin_fetched = false;
         }
     } else {
         Serial.println("[VIN] VIN not supported or invalid response");
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        strcpy(obd_data.vin, "Not Supported");
-        obd_data.vin_fetched = false;
-        xSemaphoreGive(data_mutex);
+        strcpy(info_scratch.vin, "Not Supported");
+        info_scratch.vin_fetched = false;
     }
+
+    publishVehicleInfo();
 }
@@ -17,6 +17,9 @@
 #include <ELMduino.h>
 #include "config.h"
 #include "obd_data.h"
+#include "elm_parser.h"
+#include "elm_engine.h"
+#include "pid_support.h"
 
 // ============================================================================
 // GLOBAL OBJECTS (declared here, defined in elm327.cpp)
@@ -30,25 +33,59 @@ extern ELM327 elm327;
 
 /**
  * Connect to ELM327 and initialize
- * Assumes Bluetooth is already connected
+ * Opens the Bluetooth link (connectBluetooth), then initELM327()
  * @return true if ELM327 initialized successfully, false otherwise
  */
 bool connectToELM327();
 
 /**
- * Send OBD2 command and read response
- * @param cmd Command string (e.g., "010C" for RPM)
- * @return Response string from ELM327
+ * Initialize the ELM327 on an open SPP link (second half of connectToELM327)
+ * Waits for the adapter prompt (at most ELM327_READY_TIMEOUT_MS), resets
+ * the adapter and applies the link tuning
+ * @return true if ELM327 initialized successfully, false otherwise
+ */
+bool initELM327();
+
+/**
+ * Tune the ELM327 link for throughput (called by connectToELM327)
+ * Echo/linefeeds/spaces/headers off, adaptive timing, shorter ATST,
+ * reads adapter identity (ATI) and detects clones
+ * Publishes adapter info to global vehicle_info
+ * @return true if the adapter answered the setup commands
+ */
+bool configureELMLink();
+
+/**
+ * Re-synchronize with the adapter prompt (sends a bare CR)
+ * Cheapest recovery step: fixes a reply that was cut off mid-stream
+ * @return true if the '>' prompt came back within ELM327_RESYNC_TIMEOUT_MS
+ */
+bool resyncELM327();
+
+/**
+ * Check that the ECU answers (Mode 01 PID 00)
+ * @param timeout_ms Maximum time to wait (longer after a warm start,
+ *                   the adapter searches for the protocol first)
+ * @return true if the ECU replied with 41 00
  */
-String sendOBD2Command(String cmd);
+bool probeECU(uint32_t timeout_ms = ELM327_PROBE_TIMEOUT_MS);
 
 /**
- * Parse hex byte from OBD2 response
- * @param response The full OBD2 response string
- * @param byteIndex The data byte index (0 = first data byte after PID)
- * @return Parsed byte value, or -1 on error
+ * Warm-start the adapter (ATWS) and re-apply link tuning
+ * Used when the adapter answers but lost its ECU session
+ * @return true if the adapter answered ATWS
  */
-int parseHexByte(String response, int byteIndex);
+bool warmStartELM327();
+
+/**
+ * Send OBD2/AT command and read reply into a preallocated buffer
+ * Synchronous wrapper around the command engine (queued behind polls in flight)
+ * @param cmd Command string without CR (e.g., "010C" for RPM)
+ * @param resp Response buffer (text, decoded data bytes and status)
+ * @param timeout_ms Maximum time to wait for the prompt
+ * @return true if a complete reply was received (resp.status != ELM_TIMEOUT)
+ */
+bool sendOBD2Command(const char* cmd, ELMResponse& resp, uint32_t timeout_ms = ELM327_TIMEOUT_MS);
 
 // ============================================================================
 // PID QUERY FUNCTIONS
@@ -91,44 +128,103 @@ float queryIntakeTemp();
 float queryBatteryVoltage();
 
 // ============================================================================
-// DTC FUNCTIONS
+// PIPELINED PID POLLS
+// ============================================================================
+
+/**
+ * One Mode 01 request on the command engine (single PID or batch)
+ */
+struct PIDPoll {
+    int8_t slot;                                // Engine slot (-1 = none)
+    uint8_t pids[OBD2_MAX_PIDS_PER_REQUEST];    // Requested PIDs
+    uint8_t count;                              // Number of PIDs
+    uint32_t start_ms;                          // Submit time (sample timestamp)
+    uint32_t rtt_ms;                            // Time on the wire (valid after waitPIDPoll)
+};
+
+/**
+ * Queue a Mode 01 request for one or more PIDs (returns before the reply)
+ * @param pids PIDs to request (max OBD2_MAX_PIDS_PER_REQUEST)
+ * @param count Number of PIDs (1 = single-PID request)
+ * @param poll Output handle
+ * @param repeatable Send as a bare CR if it repeats the previous request (sport mode)
+ * @return false if count is 0 (nothing submitted)
+ */
+bool submitPIDPoll(const uint8_t* pids, uint8_t count, PIDPoll& poll, bool repeatable = false);
+
+/**
+ * Wait until the reply of a poll is in (the link is free for the next request)
+ * @param poll Handle from submitPIDPoll()
+ */
+void waitPIDPoll(PIDPoll& poll);
+
+/**
+ * Decode a poll and release its engine slot (waits if still on the wire)
+ * @param poll Handle from submitPIDPoll()
+ * @param readings Output array (same order as poll.pids)
+ * @return Number of PIDs decoded, 0 on timeout/no data,
+ *         or -1 if the ECU rejected a multi-PID request
+ */
+int finishPIDPoll(PIDPoll& poll, PIDReading* readings);
+
+/**
+ * Drop a poll without decoding (waits for the reply, then releases the slot)
+ * @param poll Handle from submitPIDPoll()
+ */
+void discardPIDPoll(PIDPoll& poll);
+
+// ============================================================================
+// BATCHED PID QUERIES
 // ============================================================================
 
 /**
- * Parse DTC value to code string
- * @param dtc_value 2-byte DTC value from ECU
- * @param code Output buffer (must be at least 6 chars)
+ * Query multiple PIDs with one Mode 01 request (e.g., "010C0D05110F42")
+ * Parses single- and multi-frame (ISO-TP) responses
+ * @param pids PIDs to request (max OBD2_MAX_PIDS_PER_REQUEST)
+ * @param count Number of PIDs
+ * @param readings Output array (same order as pids)
+ * @return Number of PIDs decoded, 0 on timeout/no data,
+ *         or -1 if the ECU rejected the multi-PID request
  */
-void parseDTC(uint16_t dtc_value, char* code);
+int queryPIDsBatched(const uint8_t* pids, uint8_t count, PIDReading* readings);
 
 /**
- * Get DTC description from code
- * @param code DTC code (e.g., "P0133")
- * @return Human-readable description
+ * Query one PID with a single-PID request and return its raw data bytes
+ * @param pid Mode 01 PID
+ * @param reading Output (valid = ECU answered with enough data bytes)
+ * @return reading.valid
  */
-const char* getDTCDescription(const char* code);
+bool queryPIDRaw(uint8_t pid, PIDReading& reading);
 
 /**
- * Get DTC severity level
- * @param code DTC code (e.g., "P0133")
- * @return Severity level (0=info, 1=warning, 2=critical)
+ * Read supported-PID bitmaps (0100, then 0120/0140 if announced)
+ * @param support Output bitmaps (valid = 0100 answered, complete = no announced range failed)
+ * @return support.valid
  */
-uint8_t getDTCSeverity(const char* code);
+bool querySupportedPIDs(SupportedPIDs& support);
+
+// ============================================================================
+// DTC FUNCTIONS
+// ============================================================================
 
 /**
- * Sort DTCs by severity (critical first)
- * Operates on global obd_data.dtc_codes array
+ * Sort DTCs by severity (critical first), stored codes before pending/permanent
+ * @param codes DTC array to sort in place
+ * @param count Number of DTCs in array
  */
-void sortDTCsBySeverity();
+void sortDTCsBySeverity(DTC* codes, uint8_t count);
 
 /**
- * Query DTCs from vehicle (Mode 03)
- * Updates global obd_data structure
+ * Query stored (03), pending (07) and permanent (0A) DTCs from vehicle
+ * Decodes, merges and sorts locally, then publishes once to global vehicle_info
+ * Keeps the previous list if the ECU does not answer at all
+ * Freeze frames (Mode 02) are read again only if the codes or their status changed
  */
 void queryDTCs();
 
 /**
  * Clear all DTCs from ECU (Mode 04)
+ * Publishes empty DTC list to global vehicle_info on success
  * @return true if successful, false otherwise
  */
 bool clearAllDTCs();
@@ -139,7 +235,7 @@ bool clearAllDTCs();
 
 /**
  * Query VIN from ECU (Mode 09, PID 02)
- * Updates global obd_data structure
+ * Publishes result to global vehicle_info
  */
 void queryVIN();
 
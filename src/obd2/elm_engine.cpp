@@ -0,0 +1,151 @@
+/**
+ * ELM327 Command Engine - Implementation
+ */
+
+#include "elm_engine.h"
+#include "bluetooth.h"
+#include "../metrics/metrics.h"
+
+// ============================================================================
+// ENGINE STATE
+// ============================================================================
+
+static ELMRequest slots[ELM_ENGINE_SLOTS];
+static SemaphoreHandle_t slot_done[ELM_ENGINE_SLOTS];
+
+static QueueHandle_t free_queue = NULL;      // Slot indices ready for elmSubmit()
+static QueueHandle_t request_queue = NULL;   // Slot indices waiting for the link
+
+// Command the adapter repeats on a bare CR (empty = unknown, send in full)
+static char last_cmd[ELM_ENGINE_CMD_LEN] = "";
+
+// ============================================================================
+// TRANSPORT
+// ============================================================================
+
+bool elmTransact(const char* cmd, ELMResponse& resp, uint32_t timeout_ms, bool repeatable) {
+    // Clear input buffer
+    while (SerialBT.available()) {
+        SerialBT.read();
+    }
+
+    // Send command - a bare CR makes the adapter repeat its last command
+    bool repeat = repeatable && cmd[0] != '\0' && strcmp(cmd, last_cmd) == 0;
+    if (!repeat) {
+        SerialBT.write((const uint8_t*)cmd, strlen(cmd));
+    }
+    SerialBT.write('\r');
+
+    // Read reply straight into the fixed buffer until '>' prompt
+    elmResetResponse(resp);
+    unsigned long start = millis();
+    bool complete = false;
+
+    while (!complete && millis() - start < timeout_ms) {
+        int available = SerialBT.available();
+        if (available <= 0) {
+            vTaskDelay(1);  // Yield only while the link is idle
+            continue;
+        }
+        while (available-- > 0 && !complete) {
+            complete = elmFeedResponse(resp, (char)SerialBT.read());
+        }
+    }
+
+    elmParseResponse(resp, cmd);
+
+    // Only a cleanly answered command is known to be the adapter's last one
+    if (cmd[0] != '\0' && (resp.status == ELM_OK || resp.status == ELM_NO_DATA)) {
+        snprintf(last_cmd, sizeof(last_cmd), "%s", cmd);
+    } else {
+        last_cmd[0] = '\0';
+    }
+
+    metricsRecordCommand(resp.status, millis() - start);
+    return resp.status != ELM_TIMEOUT;
+}
+
+// ============================================================================
+// ENGINE TASK (Core 0)
+// ============================================================================
+
+/**
+ * Engine task - sends queued requests back to back, one at a time
+ */
+static void elmEngineTask(void* parameter) {
+    Serial.println("[ELM Engine] Started on Core 0");
+
+    while (true) {
+        int8_t slot;
+        if (xQueueReceive(request_queue, &slot, portMAX_DELAY) != pdTRUE) continue;
+
+        ELMRequest& req = slots[slot];
+        uint32_t start = millis();
+        elmTransact(req.cmd, req.resp, req.timeout_ms, req.repeatable);
+        req.rtt_ms = millis() - start;
+
+        xSemaphoreGive(slot_done[slot]);
+    }
+}
+
+void startELMEngine() {
+    free_queue = xQueueCreate(ELM_ENGINE_SLOTS, sizeof(int8_t));
+    request_queue = xQueueCreate(ELM_ENGINE_SLOTS, sizeof(int8_t));
+    if (free_queue == NULL || request_queue == NULL) {
+        Serial.println("ERROR: Failed to create ELM engine queues!");
+        while (1) delay(1000);
+    }
+
+    for (int8_t i = 0; i < ELM_ENGINE_SLOTS; i++) {
+        slot_done[i] = xSemaphoreCreateBinary();
+        if (slot_done[i] == NULL) {
+            Serial.println("ERROR: Failed to create ELM engine semaphore!");
+            while (1) delay(1000);
+        }
+        xQueueSend(free_queue, &i, 0);
+    }
+
+    xTaskCreatePinnedToCore(
+        elmEngineTask,               // Task function
+        "ELMEngine",                 // Task name
+        ELM_ENGINE_TASK_STACK_SIZE,  // Stack size
+        NULL,                        // Parameters
+        ELM_ENGINE_TASK_PRIORITY,    // Priority
+        NULL,                        // Task handle
+        ELM_ENGINE_TASK_CORE         // Core (0)
+    );
+    Serial.printf("✓ ELM command engine started (%d slots)\n", ELM_ENGINE_SLOTS);
+}
+
+// ============================================================================
+// REQUEST API
+// ============================================================================
+
+int8_t elmSubmit(const char* cmd, uint32_t timeout_ms, bool repeatable) {
+    int8_t slot;
+    xQueueReceive(free_queue, &slot, portMAX_DELAY);
+
+    ELMRequest& req = slots[slot];
+    snprintf(req.cmd, sizeof(req.cmd), "%s", cmd);
+    req.timeout_ms = timeout_ms;
+    req.repeatable = repeatable;
+    req.rtt_ms = 0;
+    req.completed = false;
+
+    xQueueSend(request_queue, &slot, portMAX_DELAY);
+    return slot;
+}
+
+const ELMRequest& elmAwait(int8_t slot) {
+    ELMRequest& req = slots[slot];
+    if (!req.completed) {
+        xSemaphoreTake(slot_done[slot], portMAX_DELAY);
+        req.completed = true;
+    }
+    return req;
+}
+
+void elmRelease(int8_t slot) {
+    elmAwait(slot);  // Leaves the done semaphore empty for the next user
+    xQueueSend(free_queue, &slot, portMAX_DELAY);
+}
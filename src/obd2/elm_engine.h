@@ -0,0 +1,83 @@
+/**
+ * ELM327 Command Engine
+ *
+ * Owns the ELM327 serial link in its own task (Core 0):
+ * - Requests are queued into fixed slots (command + reply buffer, no heap)
+ * - The engine sends the next queued request as soon as the '>' prompt arrives
+ * - Callers wait on a slot like a future, decode, then release it
+ *
+ * The OBD2 task keeps one poll on the wire while it decodes, publishes and
+ * logs the previous reply, so that work hides behind the Bluetooth round trip.
+ * The adapter is half-duplex: requests are sent strictly in submission order.
+ * A repeatable request equal to the previous one goes out as a bare CR,
+ * which the ELM327 answers by repeating its last command (sport mode).
+ */
+
+#ifndef ELM_ENGINE_H
+#define ELM_ENGINE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "elm_parser.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+/**
+ * One request slot (owned by the submitter from elmSubmit() to elmRelease())
+ */
+struct ELMRequest {
+    char cmd[ELM_ENGINE_CMD_LEN];   // Command without CR
+    uint32_t timeout_ms;            // Maximum wait for the prompt
+    bool repeatable;                // May be sent as a bare CR if it repeats the last command
+    uint32_t rtt_ms;                // Time on the wire (send to prompt)
+    bool completed;                 // Reply collected by elmAwait()
+    ELMResponse resp;               // Parsed reply
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Create request queues and start the engine task
+ * Must be called after initBluetooth() and before any command is sent
+ */
+void startELMEngine();
+
+/**
+ * Queue a command (blocks only while all slots are in use)
+ * @param cmd Command string without CR (truncated to ELM_ENGINE_CMD_LEN - 1)
+ * @param timeout_ms Maximum time to wait for the prompt
+ * @param repeatable Send as a bare CR when the adapter's last command was the same
+ * @return Slot handle for elmAwait()/elmRelease()
+ */
+int8_t elmSubmit(const char* cmd, uint32_t timeout_ms = ELM327_TIMEOUT_MS, bool repeatable = false);
+
+/**
+ * Wait until a submitted command has completed (returns at once if it already has)
+ * @param slot Handle from elmSubmit()
+ * @return Request with parsed reply (valid until elmRelease())
+ */
+const ELMRequest& elmAwait(int8_t slot);
+
+/**
+ * Return a slot to the pool (waits for the reply first if still on the wire)
+ * @param slot Handle from elmSubmit()
+ */
+void elmRelease(int8_t slot);
+
+/**
+ * Send one command and read the reply on the calling task
+ * Used by the engine task; nothing else may touch SerialBT while it runs
+ * @param cmd Command string without CR
+ * @param resp Response buffer
+ * @param timeout_ms Maximum time to wait for the prompt
+ * @param repeatable Send only CR if cmd equals the last cleanly answered command
+ *                   (the ELM327 repeats it; any other reply forgets the command)
+ * @return true if a complete reply was received (resp.status != ELM_TIMEOUT)
+ */
+bool elmTransact(const char* cmd, ELMResponse& resp, uint32_t timeout_ms, bool repeatable = false);
+
+#endif // ELM_ENGINE_H
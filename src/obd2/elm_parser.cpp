@@ -0,0 +1,429 @@
+/**
+ * ELM327 Response Parser - Implementation
+ */
+
+#include "elm_parser.h"
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * Compare a reply line with the sent command, ignoring spaces and case
+ */
+static bool lineMatchesCommand(const char* line, const char* line_end, const char* cmd) {
+    if (cmd == NULL || *cmd == '\0') return false;
+
+    const char* p = line;
+    while (true) {
+        while (p < line_end && *p == ' ') p++;
+        while (*cmd == ' ') cmd++;
+        if (p >= line_end || *cmd == '\0') break;
+
+        char a = *p++;
+        char b = *cmd++;
+        if (a >= 'a' && a <= 'z') a -= 32;
+        if (b >= 'a' && b <= 'z') b -= 32;
+        if (a != b) return false;
+    }
+    return p >= line_end && *cmd == '\0';
+}
+
+// ============================================================================
+// RESPONSE BUFFER
+// ============================================================================
+
+void elmResetResponse(ELMResponse& resp) {
+    resp.text[0] = '\0';
+    resp.text_len = 0;
+    resp.data_len = 0;
+    resp.status = ELM_PENDING;
+    resp.prompt_received = false;
+    resp.truncated = false;
+}
+
+bool elmFeedResponse(ELMResponse& resp, char c) {
+    if (c == '>') {
+        resp.prompt_received = true;
+        return true;
+    }
+
+    // Drop NUL bytes some clones send after reset
+    if (c == '\0') return false;
+
+    if (resp.text_len < sizeof(resp.text) - 1) {
+        resp.text[resp.text_len++] = c;
+        resp.text[resp.text_len] = '\0';
+    } else {
+        resp.truncated = true;
+    }
+    return false;
+}
+
+void elmParseResponse(ELMResponse& resp, const char* cmd) {
+    const char* p = resp.text;
+    const char* end = resp.text + resp.text_len;
+    bool first_line = true;
+
+    // ISO-TP multi-frame tracking (byte count line, e.g. "014")
+    int frame_start = 0;
+    int declared_length = -1;
+
+    resp.data_len = 0;
+
+    while (p < end) {
+        // Find line bounds
+        const char* line = p;
+        while (p < end && *p != '\r' && *p != '\n') p++;
+        const char* line_end = p;
+        if (p < end) p++;
+
+        // Skip leading spaces
+        while (line < line_end && *line == ' ') line++;
+        if (line >= line_end) continue;
+
+        // Skip command echo (ATE1)
+        if (first_line) {
+            first_line = false;
+            if (lineMatchesCommand(line, line_end, cmd)) continue;
+        }
+
+        // Strip ISO-TP frame index ("0:", "1:", ...)
+        bool has_frame_index = false;
+        if (line_end - line >= 2 && line[1] == ':' && hexValue(line[0]) >= 0) {
+            line += 2;
+            has_frame_index = true;
+        }
+
+        // Validate line: only hex digits and spaces (skips "SEARCHING...", "OK", ...)
+        int digits = 0;
+        bool all_hex = true;
+        for (const char* c = line; c < line_end; c++) {
+            if (*c == ' ') continue;
+            if (hexValue(*c) < 0) {
+                all_hex = false;
+                break;
+            }
+            digits++;
+        }
+        if (!all_hex || digits == 0) continue;
+
+        // ISO-TP byte count line - starts a new multi-frame message
+        if (digits == 3 && !has_frame_index) {
+            if (declared_length >= 0 && resp.data_len > frame_start + declared_length) {
+                resp.data_len = frame_start + declared_length;
+            }
+            int value = 0;
+            for (const char* c = line; c < line_end; c++) {
+                if (*c != ' ') value = (value << 4) | hexValue(*c);
+            }
+            frame_start = resp.data_len;
+            declared_length = value;
+            continue;
+        }
+        if (digits % 2 != 0) continue;
+
+        // Single-frame line after a multi-frame message - close it before appending
+        if (!has_frame_index && declared_length >= 0) {
+            if (resp.data_len > frame_start + declared_length) {
+                resp.data_len = frame_start + declared_length;
+            }
+            declared_length = -1;
+        }
+
+        // Decode hex pairs
+        int high = -1;
+        for (const char* c = line; c < line_end; c++) {
+            if (*c == ' ') continue;
+            int nibble = hexValue(*c);
+            if (high < 0) {
+                high = nibble;
+            } else {
+                if (resp.data_len < sizeof(resp.data)) {
+                    resp.data[resp.data_len++] = (uint8_t)((high << 4) | nibble);
+                }
+                high = -1;
+            }
+        }
+    }
+
+    // Drop padding after declared multi-frame length
+    if (declared_length >= 0 && resp.data_len > frame_start + declared_length) {
+        resp.data_len = frame_start + declared_length;
+    }
+
+    // Determine status
+    if (!resp.prompt_received) {
+        resp.status = ELM_TIMEOUT;
+    } else if (resp.truncated) {
+        resp.status = ELM_OVERFLOW;
+    } else if (resp.data_len > 0) {
+        resp.status = ELM_OK;
+    } else if (strstr(resp.text, "NO DATA") != NULL) {
+        resp.status = ELM_NO_DATA;
+    } else if (strchr(resp.text, '?') != NULL ||
+               strstr(resp.text, "ERROR") != NULL ||
+               strstr(resp.text, "UNABLE") != NULL ||
+               strstr(resp.text, "STOPPED") != NULL ||
+               strstr(resp.text, "BUFFER FULL") != NULL) {
+        resp.status = ELM_ERROR;
+    } else {
+        resp.status = ELM_OK;  // Text reply (e.g., "OK" for AT commands)
+    }
+}
+
+// ============================================================================
+// RESPONSE VIEWS
+// ============================================================================
+
+bool findPIDResponse(const ELMResponse& resp, uint8_t mode, uint8_t pid, OBDResponseView& view) {
+    for (int i = 0; i + 1 < resp.data_len; i++) {
+        if (resp.data[i] == mode && resp.data[i + 1] == pid) {
+            view.mode = mode;
+            view.pid = pid;
+            view.payload = &resp.data[i + 2];
+            view.payload_len = resp.data_len - (i + 2);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool findModeResponse(const ELMResponse& resp, uint8_t mode, OBDResponseView& view) {
+    for (int i = 0; i < resp.data_len; i++) {
+        if (resp.data[i] == mode) {
+            view.mode = mode;
+            view.pid = 0;
+            view.payload = &resp.data[i + 1];
+            view.payload_len = resp.data_len - (i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// PID DECODING
+// ============================================================================
+
+uint8_t getPIDDataLength(uint8_t pid) {
+    switch (pid) {
+        case PID_COOLANT_TEMP:    return 1;
+        case PID_RPM:             return 2;
+        case PID_SPEED:           return 1;
+        case PID_INTAKE_TEMP:     return 1;
+        case PID_THROTTLE:        return 1;
+        case PID_BATTERY_VOLTAGE: return 2;
+        case PID_ENGINE_LOAD:     return 1;
+        case PID_MAP:             return 1;
+        case PID_MAF:             return 2;
+        case PID_BARO:            return 1;
+        default:                  return 0;
+    }
+}
+
+float decodePIDValue(uint8_t pid, const uint8_t* data) {
+    switch (pid) {
+        case PID_RPM:             return ((data[0] * 256) + data[1]) / 4;
+        case PID_SPEED:           return data[0];
+        case PID_COOLANT_TEMP:    return data[0] - 40.0;
+        case PID_INTAKE_TEMP:     return data[0] - 40.0;
+        case PID_THROTTLE:        return (data[0] * 100.0) / 255.0;
+        case PID_BATTERY_VOLTAGE: return ((data[0] * 256) + data[1]) / 1000.0;
+        case PID_ENGINE_LOAD:     return (data[0] * 100.0) / 255.0;
+        case PID_MAP:             return data[0];
+        case PID_MAF:             return ((data[0] * 256) + data[1]) / 100.0;
+        case PID_BARO:            return data[0];
+        default:                  return 0;
+    }
+}
+
+int decodeMultiPIDResponse(const ELMResponse& resp, const uint8_t* pids, uint8_t count,
+                           PIDReading* readings) {
+    for (uint8_t i = 0; i < count; i++) {
+        readings[i].pid = pids[i];
+        readings[i].valid = false;
+    }
+
+    // Find start of Mode 01 response ("41" followed by a requested PID)
+    int pos = -1;
+    for (int i = 0; i + 1 < resp.data_len && pos < 0; i++) {
+        if (resp.data[i] != 0x41) continue;
+        for (uint8_t p = 0; p < count; p++) {
+            if (resp.data[i + 1] == pids[p]) {
+                pos = i + 1;
+                break;
+            }
+        }
+    }
+    if (pos < 0) {
+        return -1;
+    }
+
+    // Walk [PID][data...] pairs
+    int decoded = 0;
+    while (pos < resp.data_len) {
+        uint8_t pid = resp.data[pos];
+
+        // Some ECUs answer in several messages - skip repeated mode byte
+        if (pid == 0x41) {
+            pos++;
+            continue;
+        }
+
+        int index = -1;
+        for (uint8_t p = 0; p < count; p++) {
+            if (pids[p] == pid) {
+                index = p;
+                break;
+            }
+        }
+        uint8_t data_len = getPIDDataLength(pid);
+        if (index < 0 || data_len == 0 || pos + data_len >= resp.data_len) {
+            break;  // Unknown PID or truncated data
+        }
+
+        memcpy(readings[index].data, &resp.data[pos + 1], data_len);
+        if (!readings[index].valid) {
+            readings[index].valid = true;
+            decoded++;
+        }
+        pos += 1 + data_len;
+    }
+
+    return decoded > 0 ? decoded : -1;
+}
+
+/**
+ * Data bytes of a Mode 02 answer (PID 02 only exists in Mode 02)
+ */
+static uint8_t freezeFrameDataLength(uint8_t pid) {
+    return pid == PID_FREEZE_DTC ? 2 : getPIDDataLength(pid);
+}
+
+/**
+ * Position of a PID in the requested list
+ * @return -1 if not requested
+ */
+static int freezeFramePIDIndex(uint8_t pid, const uint8_t* pids, uint8_t count) {
+    for (uint8_t p = 0; p < count; p++) {
+        if (pids[p] == pid) return p;
+    }
+    return -1;
+}
+
+int decodeFreezeFrameResponse(const ELMResponse& resp, uint8_t frame, const uint8_t* pids,
+                              uint8_t count, PIDReading* readings) {
+    for (uint8_t i = 0; i < count; i++) {
+        readings[i].pid = pids[i];
+        readings[i].valid = false;
+    }
+
+    // Find start of Mode 02 response ("42" followed by a requested PID)
+    int pos = -1;
+    for (int i = 0; i + 1 < resp.data_len && pos < 0; i++) {
+        if (resp.data[i] == 0x42 && freezeFramePIDIndex(resp.data[i + 1], pids, count) >= 0) {
+            pos = i + 1;
+        }
+    }
+    if (pos < 0) {
+        return -1;
+    }
+
+    // Walk [PID][frame][data...] triples
+    int decoded = 0;
+    while (pos < resp.data_len) {
+        uint8_t pid = resp.data[pos];
+
+        // Some ECUs answer in several messages - skip the repeated mode byte.
+        // 0x42 is also PID_BATTERY_VOLTAGE: only a mode byte if a requested
+        // PID and this frame number follow it (a battery triple has the frame next)
+        if (pid == 0x42 && pos + 2 < resp.data_len &&
+            freezeFramePIDIndex(resp.data[pos + 1], pids, count) >= 0 &&
+            resp.data[pos + 2] == frame) {
+            pos++;
+            continue;
+        }
+
+        int index = freezeFramePIDIndex(pid, pids, count);
+        uint8_t data_len = freezeFrameDataLength(pid);
+        if (index < 0 || data_len == 0 || pos + 2 + data_len > resp.data_len) {
+            break;  // Unknown PID or truncated data
+        }
+
+        if (resp.data[pos + 1] == frame) {
+            memcpy(readings[index].data, &resp.data[pos + 2], data_len);
+            if (!readings[index].valid) {
+                readings[index].valid = true;
+                decoded++;
+            }
+        }
+        pos += 2 + data_len;
+    }
+
+    return decoded > 0 ? decoded : -1;
+}
+
+// ============================================================================
+// DTC DECODING
+// ============================================================================
+
+/**
+ * Check if data from start parses as back-to-back CAN messages [mode][count][pairs...]
+ */
+static bool isCANDTCLayout(const ELMResponse& resp, int start, uint8_t mode) {
+    int pos = start;
+    while (pos < resp.data_len) {
+        if (resp.data[pos] != mode || pos + 1 >= resp.data_len) return false;
+        pos += 2 + 2 * resp.data[pos + 1];
+    }
+    return pos == resp.data_len;
+}
+
+int decodeDTCResponse(const ELMResponse& resp, uint8_t mode, uint16_t* codes, uint8_t max_codes) {
+    int start = -1;
+    for (int i = 0; i < resp.data_len; i++) {
+        if (resp.data[i] == mode) {
+            start = i;
+            break;
+        }
+    }
+    if (start < 0) {
+        return -1;
+    }
+
+    int count = 0;
+    int pos = start;
+
+    if (isCANDTCLayout(resp, start, mode)) {
+        // CAN: count byte gives the number of pairs in each ECU message
+        while (pos < resp.data_len) {
+            int pairs = resp.data[pos + 1];
+            pos += 2;
+            for (int p = 0; p < pairs && count < max_codes; p++) {
+                uint16_t raw = (resp.data[pos + p * 2] << 8) | resp.data[pos + p * 2 + 1];
+                if (raw != 0x0000) codes[count++] = raw;
+            }
+            pos += pairs * 2;
+        }
+        return count;
+    }
+
+    // Legacy: fixed 7-byte frames, each [mode][3 pairs], unused pairs are 0000
+    while (pos < resp.data_len && resp.data[pos] == mode) {
+        pos++;
+        for (int p = 0; p < 3 && pos + 1 < resp.data_len; p++, pos += 2) {
+            uint16_t raw = (resp.data[pos] << 8) | resp.data[pos + 1];
+            if (raw != 0x0000 && count < max_codes) codes[count++] = raw;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,176 @@
+/**
+ * ELM327 Response Parser
+ *
+ * Allocation-free parsing of ELM327 replies:
+ * - Fixed-size response buffer filled up to the '>' prompt
+ * - Hex byte extraction ("41 0C 0F A0" or "410C0FA0", ISO-TP multi-frame)
+ * - Status detection (NO DATA, ERROR, ?, ...)
+ * - Response views (mode, PID, payload) pointing into the buffer
+ * - PID decoding (single and batched Mode 01)
+ *
+ * Has no Arduino/Bluetooth dependencies - transport lives in elm327.cpp
+ */
+
+#ifndef ELM_PARSER_H
+#define ELM_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+
+static_assert(ELM327_MAX_DATA_BYTES <= 255, "ELMResponse.data_len is 8-bit");
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+// Reply status (set by elmParseResponse)
+enum ELMStatus : uint8_t {
+    ELM_PENDING = 0,    // Prompt not received yet
+    ELM_OK,             // Reply contains hex data
+    ELM_NO_DATA,        // "NO DATA" - ECU did not answer
+    ELM_ERROR,          // "?", "ERROR", "UNABLE TO CONNECT", "CAN ERROR", ...
+    ELM_TIMEOUT,        // No '>' prompt within timeout
+    ELM_OVERFLOW        // Reply longer than ELM327_RX_BUFFER_SIZE (truncated)
+};
+
+/**
+ * Preallocated reply buffer
+ * Filled by elmFeedResponse(), decoded in place by elmParseResponse()
+ */
+struct ELMResponse {
+    char text[ELM327_RX_BUFFER_SIZE];       // Raw reply text (null-terminated, without '>')
+    uint16_t text_len;                      // Characters in text
+    uint8_t data[ELM327_MAX_DATA_BYTES];    // Hex bytes decoded from all frames
+    uint8_t data_len;                       // Bytes in data
+    ELMStatus status;                       // Reply status
+    bool prompt_received;                   // '>' seen
+    bool truncated;                         // Text did not fit into buffer
+};
+
+/**
+ * Parsed view of one OBD2 reply (points into ELMResponse.data, no copy)
+ */
+struct OBDResponseView {
+    uint8_t mode;               // Response mode (request mode + 0x40)
+    uint8_t pid;                // PID echo (0 for modes without PID, e.g. 03)
+    const uint8_t* payload;     // Data bytes after mode (and PID)
+    uint8_t payload_len;        // Number of payload bytes
+};
+
+/**
+ * Raw Mode 01 reading for one PID (filled by batched queries)
+ */
+struct PIDReading {
+    uint8_t pid;            // PID that was requested
+    uint8_t data[4];        // Raw data bytes (A, B, C, D)
+    bool valid;             // Whether the ECU answered this PID
+};
+
+// ============================================================================
+// RESPONSE BUFFER
+// ============================================================================
+
+/**
+ * Reset response buffer before sending a new command
+ */
+void elmResetResponse(ELMResponse& resp);
+
+/**
+ * Append one received character
+ * @return true when the '>' prompt has been received (reply complete)
+ */
+bool elmFeedResponse(ELMResponse& resp, char c);
+
+/**
+ * Decode reply text into data bytes and status
+ * Skips command echo, "SEARCHING...", ISO-TP byte count and frame indices,
+ * and drops padding after the declared multi-frame length
+ * @param resp Response buffer (text filled by elmFeedResponse)
+ * @param cmd Command that was sent (used to skip echo), may be NULL
+ */
+void elmParseResponse(ELMResponse& resp, const char* cmd);
+
+// ============================================================================
+// RESPONSE VIEWS
+// ============================================================================
+
+/**
+ * Find reply for a mode/PID pair (e.g., 0x41 0x0C)
+ * @param resp Parsed response
+ * @param mode Response mode byte (0x41, 0x49, ...)
+ * @param pid Expected PID echo
+ * @param view Output view (payload = bytes after PID)
+ * @return true if found
+ */
+bool findPIDResponse(const ELMResponse& resp, uint8_t mode, uint8_t pid, OBDResponseView& view);
+
+/**
+ * Find reply for a mode without PID (e.g., 0x43, 0x44)
+ * @param resp Parsed response
+ * @param mode Response mode byte
+ * @param view Output view (payload = bytes after mode)
+ * @return true if found
+ */
+bool findModeResponse(const ELMResponse& resp, uint8_t mode, OBDResponseView& view);
+
+// ============================================================================
+// PID DECODING
+// ============================================================================
+
+/**
+ * Get number of data bytes the ECU returns for a Mode 01 PID
+ * @param pid Mode 01 PID
+ * @return Data byte count (1-4), or 0 if PID is unknown
+ */
+uint8_t getPIDDataLength(uint8_t pid);
+
+/**
+ * Convert raw PID data bytes to engineering units
+ * @param pid Mode 01 PID
+ * @param data Raw data bytes (at least getPIDDataLength(pid) bytes)
+ * @return Decoded value (RPM, km/h, °C, %, V)
+ */
+float decodePIDValue(uint8_t pid, const uint8_t* data);
+
+/**
+ * Decode a multi-PID Mode 01 reply ("41 0C 0F A0 0D 32 ...")
+ * @param resp Parsed response
+ * @param pids Requested PIDs
+ * @param count Number of requested PIDs
+ * @param readings Output array (same order as pids)
+ * @return Number of PIDs decoded, or -1 if the reply holds no PID data
+ */
+int decodeMultiPIDResponse(const ELMResponse& resp, const uint8_t* pids, uint8_t count,
+                           PIDReading* readings);
+
+/**
+ * Decode a Mode 02 freeze-frame reply ("42 02 00 01 33 0C 00 1A F8 ...")
+ * Each answer is [PID][frame][data]; PID 02 (code that stored the frame) has 2 data bytes
+ * @param resp Parsed response
+ * @param frame Requested frame number (answers for other frames are skipped)
+ * @param pids Requested PIDs
+ * @param count Number of requested PIDs
+ * @param readings Output array (same order as pids)
+ * @return Number of PIDs decoded, or -1 if the reply holds no freeze-frame data
+ */
+int decodeFreezeFrameResponse(const ELMResponse& resp, uint8_t frame, const uint8_t* pids,
+                              uint8_t count, PIDReading* readings);
+
+// ============================================================================
+// DTC DECODING
+// ============================================================================
+
+/**
+ * Decode a Mode 03/07/0A reply into raw DTC values
+ * Handles CAN replies ("43 [count] [DTC pairs]", one message per ECU, multi-frame
+ * already reassembled) and legacy K-line/J1850 frames ("43" + 3 pairs, 0000 padded)
+ * @param resp Parsed response
+ * @param mode Response mode byte (0x43, 0x47 or 0x4A)
+ * @param codes Output array of raw DTC values (0000 padding skipped)
+ * @param max_codes Capacity of codes
+ * @return Number of codes decoded (may repeat across ECUs), or -1 if no reply for mode
+ */
+int decodeDTCResponse(const ELMResponse& resp, uint8_t mode, uint16_t* codes, uint8_t max_codes);
+
+#endif // ELM_PARSER_H
@@ -6,28 +6,404 @@
 #include "obd_data.h"
 #include "bluetooth.h"
 #include "elm327.h"
+#include "pid_scheduler.h"
+#include "pid_history.h"
+#include "derived_metrics.h"
+#include "warm_start.h"
+#include "../metrics/metrics.h"
+#include "../logger/trip_logger.h"
 
 // ============================================================================
 // GLOBAL OBJECTS
 // ============================================================================
 
-OBDData obd_data = {0};
-SemaphoreHandle_t data_mutex;
+SeqLock<LiveData> live_data;
+SeqLock<VehicleInfo> vehicle_info;
+OBDRequests obd_requests;
+EventGroupHandle_t obd_events = NULL;
+
+// Task-local copy of the live block (this task is the only writer)
+static LiveData live = {};
+
+// Last published live block (change bits are computed against it)
+static LiveData published = {};
+
+// Batched Mode 01 queries (disabled for the session if the ECU rejects them)
+static bool batch_supported = OBD2_BATCH_QUERIES;
+
+// Sport mode as applied to polling (follows obd_requests.sport_mode)
+static bool sport_active = false;
+static const uint8_t sport_pids[] = SPORT_MODE_PIDS;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * Store decoded PID value in the task-local live block
+ * Call publishLiveData() afterwards to make it visible
+ */
+static void storePIDValue(uint8_t pid, float value) {
+    switch (pid) {
+        case PID_RPM:             live.rpm = value; break;
+        case PID_SPEED:           live.speed = value; break;
+        case PID_COOLANT_TEMP:    live.coolant_temp = value; break;
+        case PID_THROTTLE:        live.throttle = value; break;
+        case PID_INTAKE_TEMP:     live.intake_temp = value; break;
+        case PID_BATTERY_VOLTAGE: live.battery_voltage = value; break;
+    }
+}
+
+/**
+ * Store derived values in the task-local live block
+ */
+static void storeDerivedValues(const DerivedValues& derived) {
+    live.fuel_rate = derived.fuel_rate;
+    live.consumption = derived.consumption;
+    live.trip_consumption = derived.trip_consumption;
+    live.engine_load = derived.engine_load;
+    live.boost = derived.boost;
+}
+
+/**
+ * Publish task-local live block to readers (lock-free)
+ * Wakes the display task with the change bits of the fields that differ
+ */
+static void publishLiveData() {
+    uint32_t changed = liveDataChanges(published, live);
+    live_data.write(live);
+    published = live;
+
+    if (changed != 0) {
+        xEventGroupSetBits(obd_events, changed);
+    }
+}
+
+/**
+ * Update connection status and error message, then publish
+ * @param connected Connection status
+ * @param error Error message (NULL to clear)
+ */
+static void setConnectionState(bool connected, const char* error) {
+    if (connected != live.connected) {
+        tripLogEvent(connected ? TRIP_EVENT_CONNECTED : TRIP_EVENT_DISCONNECTED, millis());
+    }
+    live.connected = connected;
+    if (error) {
+        snprintf(live.error, sizeof(live.error), "%s", error);
+    } else {
+        live.error[0] = '\0';
+    }
+    publishLiveData();
+}
+
+/**
+ * Report startup progress (startup screen) and publish
+ */
+static void setLinkStage(LinkStage stage) {
+    live.link_stage = stage;
+    publishLiveData();
+}
+
+/**
+ * Pick the most overdue PID(s) and queue the request on the command engine
+ * A full batch, or one PID in single-PID mode
+ * In sport mode only SPORT_MODE_PIDS are polled, always due
+ * @return true if a poll was submitted (false = nothing due yet)
+ */
+static bool submitDuePoll(PIDPoll& poll) {
+    bool sport = obd_requests.sport_mode.load();
+    if (sport != sport_active) {
+        Serial.printf("[OBD2 Task] Sport mode %s\n", sport ? "on" : "off");
+        sport_active = sport;
+        if (!sport) resetPIDScheduler();  // Slow PIDs are stale - refresh them first
+    }
+
+    uint8_t due_pids[OBD2_MAX_PIDS_PER_REQUEST];
+    uint32_t now = millis();
+    uint8_t max_pids = batch_supported ? OBD2_MAX_PIDS_PER_REQUEST : 1;
+    uint8_t due_count = sport
+        ? selectFocusPIDs(now, sport_pids, sizeof(sport_pids), due_pids, max_pids)
+        : selectDuePIDs(now, due_pids, max_pids);
+    if (due_count == 0) return false;
+
+    for (uint8_t i = 0; i < due_count; i++) {
+        markPIDPolled(due_pids[i], now);
+    }
+    return submitPIDPoll(due_pids, due_count, poll, sport && SPORT_MODE_REPEAT);
+}
+
+/**
+ * Decode a completed poll, store, publish and log its results
+ * Disables batching for the session if the ECU rejects multi-PID requests
+ * @return true if at least one PID was decoded
+ */
+static bool completePoll(PIDPoll& poll) {
+    PIDReading readings[OBD2_MAX_PIDS_PER_REQUEST];
+    int decoded = finishPIDPoll(poll, readings);
+
+    for (uint8_t i = 0; i < poll.count; i++) {
+        metricsRecordPID(poll.pids[i], poll.rtt_ms, decoded > 0 && readings[i].valid);
+    }
+
+    if (decoded < 0) {
+        if (batch_supported) {
+            Serial.println("[OBD2 Task] ECU rejected multi-PID request - falling back to single-PID mode");
+            batch_supported = false;
+            setWarmStartBatchSupported(false);
+        }
+        return false;
+    }
+    if (decoded == 0) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < poll.count; i++) {
+        if (readings[i].valid) {
+            float value = decodePIDValue(readings[i].pid, readings[i].data);
+            storePIDValue(readings[i].pid, value);
+            derivedMetricsSample(readings[i].pid, value);
+            pidHistoryPush(readings[i].pid, value, poll.start_ms);
+            tripLogSample(readings[i].pid, readings[i].data, getPIDDataLength(readings[i].pid), poll.start_ms);
+        }
+    }
+
+    // Derived values from this poll's samples (published with the raw values)
+    DerivedValues derived;
+    derivedMetricsUpdate(poll.start_ms, derived);
+    storeDerivedValues(derived);
+
+    publishLiveData();
+    xEventGroupSetBits(obd_events, OBD_EVT_SAMPLE);
+
+    // Per-poll trace (rates and latencies are in the metrics module)
+    if (METRICS_LOG_POLLS) {
+        if (poll.count > 1) {
+            Serial.printf("Batch: %d/%d PIDs (RPM: %d, Speed: %d km/h)\n",
+                          decoded, poll.count, live.rpm, live.speed);
+        } else {
+            Serial.printf("PID 0x%02X: %.1f\n", poll.pids[0],
+                          decodePIDValue(readings[0].pid, readings[0].data));
+        }
+    }
+    return true;
+}
+
+/**
+ * Restrict polling to PIDs the ECU supports
+ * Bitmaps come from the NVS cache for this VIN, or are probed once and cached
+ * Without bitmaps (probe failed) all PIDs stay enabled
+ */
+static void setupSupportedPIDs() {
+    static VehicleInfo info;
+    metricsTimedRead(vehicle_info, info);
+
+    SupportedPIDs support;
+    bool cached = info.vin_fetched && loadSupportedPIDs(info.vin, support);
+
+    if (cached) {
+        Serial.printf("[PIDs] Using cached bitmaps for VIN %s\n", info.vin);
+    } else if (querySupportedPIDs(support)) {
+        if (info.vin_fetched && !info.vin_cached && support.complete) {
+            saveSupportedPIDs(info.vin, support);
+            Serial.printf("[PIDs] Bitmaps cached for VIN %s\n", info.vin);
+        }
+    } else {
+        Serial.println("[PIDs] Supported-PID query failed - polling all PIDs");
+    }
+
+    // Without bitmaps every PID counts as supported (also undoes a previous vehicle's map)
+    uint8_t count;
+    const PIDSchedule* schedule = getPIDSchedule(count);
+    for (uint8_t i = 0; i < count; i++) {
+        bool supported = isPIDSupported(support, schedule[i].pid);
+        setPIDSupported(schedule[i].pid, supported);
+        if (!supported) {
+            Serial.printf("[PIDs] PID 0x%02X not supported - not polled\n", schedule[i].pid);
+        }
+    }
+}
+
+// ============================================================================
+// CONNECTION RECOVERY
+// ============================================================================
+
+// Delay before the next full Bluetooth restart (doubles per failed attempt)
+static uint32_t full_reconnect_backoff_ms = BT_RECONNECT_BACKOFF_MIN_MS;
+
+/**
+ * Tier 1: link still up - resync the prompt, warm-start if the ECU is silent
+ * Dashboard keeps showing data (sub-second, no disconnect shown)
+ */
+static bool recoverELMSession() {
+    if (!isBluetoothConnected()) return false;
+
+    if (resyncELM327() && probeECU()) return true;
+
+    // Adapter may still be up but lost its ECU session (e.g. engine cranking)
+    return warmStartELM327() && probeECU(ELM327_TIMEOUT_MS);
+}
+
+/**
+ * Tier 2: SPP link dropped - reconnect without restarting the Bluetooth stack
+ * The adapter keeps its settings across an SPP reconnect, re-apply them anyway
+ */
+static bool recoverSPPLink() {
+    if (!reconnectBluetooth()) return false;
+
+    if (!resyncELM327()) return false;
+    configureELMLink();
+    return probeECU();
+}
+
+/**
+ * Tier 3: full Bluetooth teardown and ELM327 re-init (last resort)
+ * Failed attempts wait with exponential backoff, reset on success
+ */
+static bool recoverFull() {
+    disconnectBluetooth();
+    initBluetooth();
+
+    if (connectToELM327()) {
+        full_reconnect_backoff_ms = BT_RECONNECT_BACKOFF_MIN_MS;
+        batch_supported = OBD2_BATCH_QUERIES;  // Re-probe batching on new session
+        setWarmStartBatchSupported(batch_supported);
+        return true;
+    }
+
+    Serial.printf("[OBD2 Task] Full reconnect failed, retrying in %lu ms\n",
+                  (unsigned long)full_reconnect_backoff_ms);
+    vTaskDelay(pdMS_TO_TICKS(full_reconnect_backoff_ms));
+    full_reconnect_backoff_ms *= 2;
+    if (full_reconnect_backoff_ms > BT_RECONNECT_BACKOFF_MAX_MS) {
+        full_reconnect_backoff_ms = BT_RECONNECT_BACKOFF_MAX_MS;
+    }
+    return false;
+}
+
+/**
+ * Query the VIN after a warm start and compare it with the cached one
+ * A different vehicle drops what was learned for the cached VIN: supported
+ * PIDs are set up again and batching is re-probed (the DTC list was already
+ * refreshed after the first poll)
+ */
+static void confirmCachedVIN() {
+    char cached_vin[sizeof(VehicleInfo::vin)];
+    snprintf(cached_vin, sizeof(cached_vin), "%s", getWarmStartBoot().vin);
+
+    Serial.println("[OBD2 Task] Confirming cached VIN...");
+    queryVIN();
+
+    static VehicleInfo info;
+    metricsTimedRead(vehicle_info, info);
+    if (!info.vin_fetched) {
+        Serial.println("[OBD2 Task] VIN not readable - keeping the cached vehicle state");
+        return;
+    }
+    if (strcmp(info.vin, cached_vin) == 0) {
+        Serial.println("[OBD2 Task] Cached VIN confirmed");
+        return;
+    }
+
+    Serial.printf("[OBD2 Task] Different vehicle (VIN %s) - rediscovering\n", info.vin);
+    batch_supported = OBD2_BATCH_QUERIES;
+    setWarmStartBatchSupported(batch_supported);
+    setupSupportedPIDs();
+    resetPIDScheduler();
+}
+
+/**
+ * Readiness probe after connect, replaces a fixed settle delay
+ * The first probe allows for the adapter's protocol search, the next ones
+ * retry a slow or sleeping ECU
+ * @return true once the ECU answers (false = polling starts anyway)
+ */
+static bool waitForECU() {
+    uint32_t start = millis();
+    for (int attempt = 0; attempt < ELM327_ECU_READY_ATTEMPTS; attempt++) {
+        if (probeECU(attempt == 0 ? ELM327_SEARCH_TIMEOUT_MS : ELM327_PROBE_TIMEOUT_MS)) {
+            Serial.printf("[OBD2 Task] ECU ready after %lu ms\n", (unsigned long)(millis() - start));
+            return true;
+        }
+    }
+    Serial.println("[OBD2 Task] ECU not answering yet - starting to poll anyway");
+    return false;
+}
+
+/**
+ * Recover a lost link, cheapest step first
+ * Only reports disconnected once the in-session resync has failed
+ * @return true if connected again
+ */
+static bool recoverConnection() {
+    uint32_t start = millis();
+
+    Serial.println("[OBD2 Task] Recovery tier 1: prompt resync");
+    if (recoverELMSession()) {
+        Serial.printf("[OBD2 Task] Recovered in session (%lu ms)\n", (unsigned long)(millis() - start));
+        return true;
+    }
+
+    setConnectionState(false, "Connection lost (reconnecting)");
+
+    Serial.println("[OBD2 Task] Recovery tier 2: SPP reconnect");
+    if (recoverSPPLink()) {
+        Serial.printf("[OBD2 Task] Reconnected SPP link (%lu ms)\n", (unsigned long)(millis() - start));
+        setConnectionState(true, NULL);
+        return true;
+    }
+
+    Serial.println("[OBD2 Task] Recovery tier 3: full Bluetooth restart");
+    if (recoverFull()) {
+        Serial.printf("[OBD2 Task] Reconnected after full restart (%lu ms)\n", (unsigned long)(millis() - start));
+        setConnectionState(true, NULL);
+        return true;
+    }
+
+    setConnectionState(false, "Connection lost (timeout)");
+    return false;
+}
 
 // ============================================================================
 // INITIALIZATION
 // ============================================================================
 
 void initOBD2() {
-    // Create mutex for shared data
-    data_mutex = xSemaphoreCreateMutex();
-    if (data_mutex == NULL) {
-        Serial.println("ERROR: Failed to create data mutex!");
+    // Shared data is published lock-free (SeqLock), only reset request flags
+    obd_requests.dtc_refresh.store(false);
+    obd_requests.dtc_clear.store(false);
+    obd_requests.sport_mode.store(false);
+
+    // Change notification for the display task
+    obd_events = xEventGroupCreate();
+    if (obd_events == NULL) {
+        Serial.println("ERROR: Failed to create OBD event group!");
         while (1) delay(1000);
     }
 
+    // Warm start: last VIN, adapter and DTCs are shown until the ECU answers
+    // (loadWarmStartCache() ran first)
+    static VehicleInfo cached_info = {};
+    if (fillVehicleInfoFromWarmStart(cached_info)) {
+        vehicle_info.write(cached_info);
+        batch_supported = getWarmStartBoot().batch_supported;
+    }
+
+    // Trend history rings (filled by completePoll)
+    initPIDHistory();
+
+    // Derived values start unknown (NAN) until their inputs are polled
+    resetDerivedMetrics();
+    DerivedValues derived = {NAN, NAN, NAN, NAN, NAN};
+    storeDerivedValues(derived);
+    published = live;
+    live_data.write(live);
+
     // Initialize Bluetooth
     initBluetooth();
+
+    // Command engine owns the serial link from here on
+    startELMEngine();
 }
 
 // ============================================================================
@@ -37,12 +413,15 @@ void initOBD2() {
 void obd2Task(void *parameter) {
     Serial.println("[OBD2 Task] Starting on Core 0...");
 
-    // Connect to ELM327
-    if (!connectToELM327()) {
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        obd_data.connected = false;
-        snprintf(obd_data.error, sizeof(obd_data.error), "Connection failed");
-        xSemaphoreGive(data_mutex);
+    // Connect to ELM327 (each step is shown on the startup screen)
+    setLinkStage(LINK_STAGE_BLUETOOTH);
+    bool link_up = connectBluetooth();
+    if (link_up) {
+        setLinkStage(LINK_STAGE_ADAPTER);
+        link_up = initELM327();
+    }
+    if (!link_up) {
+        setConnectionState(false, "Connection failed");
 
         Serial.println("[OBD2 Task] Connection failed, task ending");
         vTaskDelete(NULL);
@@ -50,34 +429,29 @@ void obd2Task(void *parameter) {
     }
 
     // Mark as connected
-    xSemaphoreTake(data_mutex, portMAX_DELAY);
-    obd_data.connected = true;
-    obd_data.error[0] = '\0';
-    obd_data.dtc_fetched = false;
-    xSemaphoreGive(data_mutex);
-
-    // Wait a bit for connection to stabilize before querying vehicle info
-    Serial.println("[OBD2 Task] Waiting 3 seconds before querying vehicle info...");
-    vTaskDelay(pdMS_TO_TICKS(3000));
-
-    // Query DTCs once after connection
-    queryDTCs();
+    setConnectionState(true, NULL);
+
+    // Probe until the ECU answers instead of waiting a fixed time
+    setLinkStage(LINK_STAGE_ECU);
+    waitForECU();
+
+    // Query VIN once after connection (keys the supported-PID cache)
+    // Warm start: the cached VIN selects the bitmaps now, it is confirmed after the first poll
+    setLinkStage(LINK_STAGE_VEHICLE);
+    bool vin_check_pending = getWarmStartBoot().vin[0] != '\0';  // initOBD2() published it
+    if (vin_check_pending) {
+        Serial.printf("[OBD2 Task] Warm start with cached VIN %s\n", getWarmStartBoot().vin);
+    } else {
+        Serial.println("[OBD2 Task] Querying VIN...");
+        queryVIN();
+    }
 
-    // Query VIN once after connection
-    Serial.println("[OBD2 Task] Querying VIN...");
-    queryVIN();
+    // Adaptive PID polling (per-PID rates from config.h), supported PIDs only
+    initPIDScheduler();
+    setupSupportedPIDs();
 
-    // PID query rotation
-    uint8_t pid_index = 0;
-    const uint8_t pids[] = {
-        PID_RPM,
-        PID_SPEED,
-        PID_COOLANT_TEMP,
-        PID_THROTTLE,
-        PID_INTAKE_TEMP,
-        PID_BATTERY_VOLTAGE
-    };
-    const uint8_t num_pids = sizeof(pids) / sizeof(pids[0]);
+    // Query DTCs once after connection - after the first poll, values come first
+    obd_requests.dtc_refresh.store(true);
 
     Serial.println("[OBD2 Task] Starting query loop...\n");
 
@@ -85,131 +459,67 @@ void obd2Task(void *parameter) {
     int consecutive_failures = 0;
     const int MAX_FAILURES_BEFORE_DISCONNECT = 3;
 
+    // Two polls alternate: one on the wire while the other is decoded
+    PIDPoll polls[2];
+    uint8_t current = 0;
+    bool in_flight = false;
+
     while (true) {
-        uint8_t current_pid = pids[pid_index];
-        float value = 0;
-        bool success = false;
-
-        // Query PID using manual functions (bypass ELMduino bug)
-        switch (current_pid) {
-            case PID_RPM:
-                {
-                    int rpm = queryRPM();
-                    if (rpm >= 0) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.rpm = rpm;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("RPM: %d\n", rpm);
-                        success = true;
-                    }
-                }
-                break;
-
-            case PID_SPEED:
-                {
-                    int spd = querySpeed();
-                    if (spd >= 0) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.speed = spd;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("Speed: %d km/h\n", spd);
-                        success = true;
-                    }
-                }
-                break;
-
-            case PID_COOLANT_TEMP:
-                {
-                    float temp = queryCoolantTemp();
-                    if (temp > -100) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.coolant_temp = temp;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("Coolant: %.1f°C\n", temp);
-                        success = true;
-                    }
-                }
-                break;
-
-            case PID_THROTTLE:
-                {
-                    float thr = queryThrottle();
-                    if (thr >= 0) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.throttle = thr;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("Throttle: %.1f%%\n", thr);
-                        success = true;
-                    }
-                }
-                break;
-
-            case PID_INTAKE_TEMP:
-                {
-                    float temp = queryIntakeTemp();
-                    if (temp > -100) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.intake_temp = temp;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("Intake: %.1f°C\n", temp);
-                        success = true;
-                    }
-                }
-                break;
-
-            case PID_BATTERY_VOLTAGE:
-                {
-                    float volt = queryBatteryVoltage();
-                    if (volt > 0) {
-                        xSemaphoreTake(data_mutex, portMAX_DELAY);
-                        obd_data.battery_voltage = volt;
-                        xSemaphoreGive(data_mutex);
-                        Serial.printf("Battery: %.1fV\n", volt);
-                        success = true;
-                    }
+        // Previous recovery failed - keep recovering before polling again
+        if (!live.connected) {
+            if (!recoverConnection()) continue;
+            consecutive_failures = 0;
+            resetPIDScheduler();
+        }
+
+        // Nothing on the wire (start, after idling or recovery) - submit now
+        if (!in_flight) {
+            in_flight = submitDuePoll(polls[current]);
+        }
+
+        bool success = true;
+
+        if (in_flight) {
+            PIDPoll& poll = polls[current];
+
+            // Queue the next request as soon as this reply is in: the engine
+            // sends it while this one is decoded, published and logged
+            waitPIDPoll(poll);
+            current ^= 1;
+            in_flight = submitDuePoll(polls[current]);
+
+            success = completePoll(poll);
+            if (success && live.link_stage != LINK_STAGE_READY) {
+                setLinkStage(LINK_STAGE_READY);  // First values are in - startup screen exits
+            }
+            if (!success) {
+                if (poll.count > 1) {
+                    Serial.printf("Batched query (%d PIDs) failed\n", poll.count);
+                } else {
+                    Serial.printf("PID 0x%02X query failed\n", poll.pids[0]);
                 }
-                break;
+            }
         }
 
         // Check for errors and track consecutive failures
         if (!success) {
-            Serial.printf("PID 0x%02X query failed\n", current_pid);
             consecutive_failures++;
 
             // If too many consecutive failures, assume disconnected
             if (consecutive_failures >= MAX_FAILURES_BEFORE_DISCONNECT) {
                 Serial.printf("[OBD2 Task] %d consecutive failures - connection lost!\n", consecutive_failures);
 
-                // Mark as disconnected
-                xSemaphoreTake(data_mutex, portMAX_DELAY);
-                obd_data.connected = false;
-                snprintf(obd_data.error, sizeof(obd_data.error), "Connection lost (timeout)");
-                xSemaphoreGive(data_mutex);
-
-                // Close existing connection
-                disconnectBluetooth();
-
-                // Reinitialize Bluetooth
-                initBluetooth();
-
-                // Wait before attempting reconnect
-                Serial.println("[OBD2 Task] Waiting 5 seconds before reconnect...");
-                vTaskDelay(pdMS_TO_TICKS(5000));
-
-                // Attempt to reconnect
-                Serial.println("[OBD2 Task] Attempting to reconnect...");
-                if (connectToELM327()) {
-                    Serial.println("[OBD2 Task] Reconnected successfully!");
-                    xSemaphoreTake(data_mutex, portMAX_DELAY);
-                    obd_data.connected = true;
-                    obd_data.error[0] = '\0';
-                    xSemaphoreGive(data_mutex);
+                // Recovery may talk to SerialBT directly - take the queued poll off the engine first
+                if (in_flight) {
+                    discardPIDPoll(polls[current]);
+                    in_flight = false;
+                }
+
+                if (recoverConnection()) {
                     consecutive_failures = 0;  // Reset failure counter
+                    resetPIDScheduler();
                 } else {
-                    Serial.println("[OBD2 Task] Reconnection failed, will retry...");
-                    consecutive_failures = 0;  // Reset to try again
-                    vTaskDelay(pdMS_TO_TICKS(2000));
-                    continue;  // Skip to next iteration
+                    continue;  // Retried at the top of the loop (backoff already applied)
                 }
             }
         } else {
@@ -217,27 +527,15 @@ void obd2Task(void *parameter) {
             consecutive_failures = 0;
         }
 
-        // Move to next PID
-        pid_index = (pid_index + 1) % num_pids;
-
-        // Check for DTC operation requests (from UI thread)
-        bool dtc_refresh_req = false;
-        bool dtc_clear_req = false;
-
-        xSemaphoreTake(data_mutex, portMAX_DELAY);
-        dtc_refresh_req = obd_data.dtc_refresh_requested;
-        dtc_clear_req = obd_data.dtc_clear_requested;
-        xSemaphoreGive(data_mutex);
+        // Check for DTC operation requests (from UI thread), clearing flags atomically
+        bool dtc_clear_req = obd_requests.dtc_clear.exchange(false);
+        bool dtc_refresh_req = obd_requests.dtc_refresh.exchange(false);
 
         // Handle DTC Clear request
         if (dtc_clear_req) {
             Serial.println("[OBD2 Task] Processing DTC clear request...");
             bool clear_success = clearAllDTCs();
 
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            obd_data.dtc_clear_requested = false;  // Clear flag
-            xSemaphoreGive(data_mutex);
-
             if (clear_success) {
                 Serial.println("[OBD2 Task] DTCs cleared successfully");
                 // Query DTCs to update display
@@ -251,15 +549,21 @@ void obd2Task(void *parameter) {
         if (dtc_refresh_req) {
             Serial.println("[OBD2 Task] Processing DTC refresh request...");
             queryDTCs();
-
-            xSemaphoreTake(data_mutex, portMAX_DELAY);
-            obd_data.dtc_refresh_requested = false;  // Clear flag
-            xSemaphoreGive(data_mutex);
-
             Serial.println("[OBD2 Task] DTC refresh complete");
         }
 
-        // Wait before next query
-        vTaskDelay(pdMS_TO_TICKS(OBD2_QUERY_INTERVAL_MS));
+        // Warm start: confirm the cached VIN once values are flowing
+        if (vin_check_pending && success) {
+            vin_check_pending = false;
+            confirmCachedVIN();
+        }
+
+        // A poll is already on the wire - its reply is the next wake-up
+        if (in_flight) continue;
+
+        // Sleep until the next PID is due (at least one tick, at most one pass interval)
+        uint32_t idle_ms = getMsUntilNextDue(millis());
+        if (idle_ms > OBD2_QUERY_INTERVAL_MS) idle_ms = OBD2_QUERY_INTERVAL_MS;
+        vTaskDelay(idle_ms > 0 ? pdMS_TO_TICKS(idle_ms) : 1);
     }
 }
@@ -21,7 +21,7 @@
 
 /**
  * Initialize OBD2 module
- * Creates data mutex and initializes Bluetooth
+ * Resets request flags and initializes Bluetooth
  * Must be called before starting obd2Task
  */
 void initOBD2();
@@ -3,61 +3,202 @@
  *
  * Shared data structures used across OBD2 module
  * Includes DTC codes, vehicle data, and synchronization primitives
+ *
+ * Data is split by update rate and published lock-free (SeqLock):
+ * - LiveData: hot block, rewritten many times per second
+ * - VehicleInfo: cold block (DTCs, VIN), rewritten on DTC/VIN queries only
+ * Readers copy only the block they need and can skip unchanged versions.
+ * Every publish also sets per-field change bits in obd_events, so the display
+ * task sleeps until something it shows has actually changed.
  */
 
 #ifndef OBD_DATA_H
 #define OBD_DATA_H
 
 #include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "seqlock.h"
+#include "dtc_table.h"
 
 // ============================================================================
 // DTC DEFINITIONS
 // ============================================================================
 
-// DTC severity levels
-#define DTC_SEVERITY_INFO       0
-#define DTC_SEVERITY_WARNING    1
-#define DTC_SEVERITY_CRITICAL   2
+// Severity levels and description table: dtc_table.h
+
+// DTC status flags (which modes reported the code, may be combined)
+#define DTC_STATUS_STORED       0x01   // Mode 03 - confirmed, MIL may be on
+#define DTC_STATUS_PENDING      0x02   // Mode 07 - detected in current/last drive cycle
+#define DTC_STATUS_PERMANENT    0x04   // Mode 0A - survives clearing until ECU verifies repair
+
+static_assert(MAX_DTC_CODES <= 255, "VehicleInfo.dtc_count is 8-bit");
 
 struct DTC {
-    char code[6];           // e.g., "P0133"
-    char description[80];   // e.g., "O2 Sensor Slow Response"
-    uint8_t severity;       // 0=info, 1=warning, 2=critical
+    uint16_t raw;               // Raw 2-byte value from ECU
+    char code[6];               // e.g., "P0133"
+    const char* description;    // e.g., "O2 Sensor Slow Response" (points into flash table)
+    uint8_t severity;           // 0=info, 1=warning, 2=critical
+    uint8_t status;             // DTC_STATUS_* flags
+};
+
+// Signals of a freeze frame (order of FreezeFrame.values)
+static const uint8_t freeze_frame_pids[] = FREEZE_FRAME_PIDS;
+
+#define FREEZE_FRAME_PID_COUNT  (sizeof(freeze_frame_pids) / sizeof(freeze_frame_pids[0]))
+
+static_assert(FREEZE_FRAME_PID_COUNT <= 8, "FreezeFrame.valid_mask is 8-bit");
+
+/**
+ * Mode 02 snapshot the ECU stored when a code was set
+ */
+struct FreezeFrame {
+    uint16_t dtc_raw;                       // Code that stored the frame (PID 02)
+    uint8_t frame;                          // Mode 02 frame number
+    uint8_t valid_mask;                     // Bit i: freeze_frame_pids[i] answered
+    float values[FREEZE_FRAME_PID_COUNT];   // decodePIDValue() units
 };
 
 // ============================================================================
-// OBD DATA STRUCTURE
+// OBD DATA STRUCTURES
 // ============================================================================
 
-struct OBDData {
+// Startup progress of the OBD2 task (LiveData.link_stage, shown by the startup screen)
+enum LinkStage : uint8_t {
+    LINK_STAGE_BLUETOOTH = 0,   // Connecting the SPP link
+    LINK_STAGE_ADAPTER,         // Adapter prompt, reset and link tuning
+    LINK_STAGE_ECU,             // Waiting for the ECU (protocol search)
+    LINK_STAGE_VEHICLE,         // VIN and supported PIDs
+    LINK_STAGE_READY            // First values published
+};
+
+// Hot block: live PID values (written by OBD2 task on every query)
+struct LiveData {
     float coolant_temp;      // °C
     uint16_t rpm;            // RPM
     uint8_t speed;           // km/h
     float battery_voltage;   // V
     float intake_temp;       // °C
     float throttle;          // %
+
+    // Derived on Core 0 (derived_metrics.h), NAN = not known yet
+    float fuel_rate;         // L/h
+    float consumption;       // L/100km (instant)
+    float trip_consumption;  // L/100km (since boot)
+    float engine_load;       // % (smoothed)
+    float boost;             // kPa above barometric pressure
+
     bool connected;          // ELM327 connection status
     char error[64];          // Error message
+    uint8_t link_stage;      // LinkStage, stays LINK_STAGE_READY after the first values
+};
 
+// Cold block: diagnostics and vehicle information (written on DTC/VIN queries)
+struct VehicleInfo {
     // Diagnostic Trouble Codes
-    DTC dtc_codes[12];       // Store up to 12 DTCs
+    DTC dtc_codes[MAX_DTC_CODES];  // Stored, pending and permanent codes (sorted by severity)
     uint8_t dtc_count;       // Number of active DTCs
     bool dtc_fetched;        // Whether DTCs have been fetched
 
-    // DTC Request Flags (set by UI thread, cleared by OBD2 task)
-    bool dtc_refresh_requested;  // Request DTC refresh from ECU
-    bool dtc_clear_requested;    // Request clear all DTCs
+    // Freeze frames of the codes above (matched by raw code, read per DTC set change)
+    FreezeFrame freeze_frames[FREEZE_FRAME_MAX_FRAMES];
+    uint8_t freeze_frame_count;
 
     // Vehicle Information (fetched once at startup)
     char vin[18];                // Vehicle Identification Number (17 chars + null)
     bool vin_fetched;            // Whether VIN has been fetched
+    bool vin_cached;             // VIN (and DTCs) from the warm-start cache, not confirmed yet
+
+    // Adapter Information (fetched on every connect)
+    char adapter[24];            // ATI reply, e.g. "ELM327 v1.5"
+    bool adapter_clone;          // Clone detected (reduced feature set)
+};
+
+/**
+ * Freeze frame stored for a code
+ * @return NULL if the ECU stored none for it
+ */
+inline const FreezeFrame* findFreezeFrame(const VehicleInfo& info, uint16_t dtc_raw) {
+    for (uint8_t i = 0; i < info.freeze_frame_count; i++) {
+        if (info.freeze_frames[i].dtc_raw == dtc_raw) return &info.freeze_frames[i];
+    }
+    return NULL;
+}
+
+// ============================================================================
+// CHANGE NOTIFICATION (obd_events bits, set by the OBD2 task on publish)
+// ============================================================================
+// Bit ownership: 0-7 and 10 value change bits, 9 new samples (OBD2 task),
+// 8 render command queued (display manager). All bits are defined here.
+
+#define OBD_EVT_RPM             (1 << 0)
+#define OBD_EVT_SPEED           (1 << 1)
+#define OBD_EVT_COOLANT         (1 << 2)
+#define OBD_EVT_THROTTLE        (1 << 3)
+#define OBD_EVT_BATTERY         (1 << 4)
+#define OBD_EVT_INTAKE          (1 << 5)
+#define OBD_EVT_CONNECTION      (1 << 6)   // connected flag, link stage or error message
+#define OBD_EVT_VEHICLE_INFO    (1 << 7)   // DTC list, VIN or adapter info
+#define OBD_EVT_DERIVED         (1 << 10)  // any derived_metrics.h value
+#define OBD_EVT_LIVE_VALUES     (OBD_EVT_RPM | OBD_EVT_SPEED | OBD_EVT_COOLANT | \
+                                 OBD_EVT_THROTTLE | OBD_EVT_BATTERY | OBD_EVT_INTAKE | \
+                                 OBD_EVT_DERIVED)
+#define OBD_EVT_ALL             (OBD_EVT_LIVE_VALUES | OBD_EVT_CONNECTION | OBD_EVT_VEHICLE_INFO)
+
+// Render command queued for the display task (set by requestPageRedraw() and friends)
+#define DISPLAY_EVT_RENDER      (1 << 8)
+
+// New samples in pid_history.h, set after every decoded poll even if no value changed
+// (only trend views wait for this bit)
+#define OBD_EVT_SAMPLE          (1 << 9)
+
+/**
+ * Whether two derived values are equal (NAN equals NAN: still unknown)
+ */
+inline bool sameDerivedValue(float a, float b) {
+    return a == b || (isnan(a) && isnan(b));
+}
+
+/**
+ * Per-field change bits between two live snapshots
+ * @return OBD_EVT_* bits of the fields that differ
+ */
+inline uint32_t liveDataChanges(const LiveData& before, const LiveData& after) {
+    uint32_t bits = 0;
+    if (before.rpm != after.rpm)                         bits |= OBD_EVT_RPM;
+    if (before.speed != after.speed)                     bits |= OBD_EVT_SPEED;
+    if (before.coolant_temp != after.coolant_temp)       bits |= OBD_EVT_COOLANT;
+    if (before.throttle != after.throttle)               bits |= OBD_EVT_THROTTLE;
+    if (before.battery_voltage != after.battery_voltage) bits |= OBD_EVT_BATTERY;
+    if (before.intake_temp != after.intake_temp)         bits |= OBD_EVT_INTAKE;
+    if (!sameDerivedValue(before.fuel_rate, after.fuel_rate) ||
+        !sameDerivedValue(before.consumption, after.consumption) ||
+        !sameDerivedValue(before.trip_consumption, after.trip_consumption) ||
+        !sameDerivedValue(before.engine_load, after.engine_load) ||
+        !sameDerivedValue(before.boost, after.boost))   bits |= OBD_EVT_DERIVED;
+    if (before.connected != after.connected ||
+        before.link_stage != after.link_stage ||
+        strcmp(before.error, after.error) != 0)          bits |= OBD_EVT_CONNECTION;
+    return bits;
+}
+
+// DTC Request Flags (set by UI thread, cleared by OBD2 task)
+struct OBDRequests {
+    std::atomic<bool> dtc_refresh;   // Request DTC refresh from ECU
+    std::atomic<bool> dtc_clear;     // Request clear all DTCs
+    std::atomic<bool> sport_mode;    // Poll SPORT_MODE_PIDS only (toggled by UI, read by OBD2 task)
 };
 
 // ============================================================================
 // GLOBAL OBJECTS (declared here, defined in obd2_task.cpp)
 // ============================================================================
 
-extern OBDData obd_data;
-extern SemaphoreHandle_t data_mutex;
+// Written only by the OBD2 task (single writer), read from any task
+extern SeqLock<LiveData> live_data;
+extern SeqLock<VehicleInfo> vehicle_info;
+extern OBDRequests obd_requests;
+
+// Change notification for the display task (OBD_EVT_* and DISPLAY_EVT_RENDER bits, see above)
+extern EventGroupHandle_t obd_events;
 
 #endif // OBD_DATA_H
@@ -0,0 +1,96 @@
+/**
+ * PID History Module - Implementation
+ */
+
+#include "pid_history.h"
+#include <Arduino.h>
+#include <atomic>
+#include <esp_heap_caps.h>
+
+// ============================================================================
+// RINGS
+// ============================================================================
+
+// Live PIDs with a ring (order of the slots)
+static const uint8_t history_pids[] = {
+    PID_RPM, PID_SPEED, PID_THROTTLE, PID_COOLANT_TEMP, PID_INTAKE_TEMP, PID_BATTERY_VOLTAGE
+};
+
+#define HISTORY_SLOTS  (sizeof(history_pids) / sizeof(history_pids[0]))
+
+struct PIDRing {
+    PIDSample* samples;             // PID_HISTORY_CAPACITY samples (NULL = not allocated)
+    std::atomic<uint32_t> count;    // Samples pushed (written by the OBD2 task only)
+};
+
+static PIDRing rings[HISTORY_SLOTS];
+
+/**
+ * Ring of a PID, or NULL if the PID has none (or history is not allocated)
+ */
+static PIDRing* findRing(uint8_t pid) {
+    for (uint8_t i = 0; i < HISTORY_SLOTS; i++) {
+        if (history_pids[i] == pid) {
+            return rings[i].samples != NULL ? &rings[i] : NULL;
+        }
+    }
+    return NULL;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void initPIDHistory() {
+    // One block for all rings: PSRAM if available, internal RAM otherwise
+    size_t bytes = HISTORY_SLOTS * PID_HISTORY_CAPACITY * sizeof(PIDSample);
+    PIDSample* block = (PIDSample*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (block == NULL) {
+        block = (PIDSample*)heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    }
+    if (block == NULL) {
+        Serial.println("[History] Ring allocation failed - trend history disabled");
+        return;
+    }
+
+    for (uint8_t i = 0; i < HISTORY_SLOTS; i++) {
+        rings[i].samples = block + i * PID_HISTORY_CAPACITY;
+        rings[i].count.store(0, std::memory_order_relaxed);
+    }
+    Serial.printf("✓ PID history: %d PIDs x %d samples (%u bytes)\n",
+                  (int)HISTORY_SLOTS, PID_HISTORY_CAPACITY, (unsigned)bytes);
+}
+
+void pidHistoryPush(uint8_t pid, float value, uint32_t time_ms) {
+    PIDRing* ring = findRing(pid);
+    if (ring == NULL) return;
+
+    // Single producer: write the slot, then publish it with the new count
+    // (fence: a reader that sees the overwrite also sees the count that allowed it)
+    uint32_t seq = ring->count.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    PIDSample& sample = ring->samples[seq & (PID_HISTORY_CAPACITY - 1)];
+    sample.time_ms = time_ms;
+    sample.value = value;
+    ring->count.store(seq + 1, std::memory_order_release);
+}
+
+uint32_t pidHistoryCount(uint8_t pid) {
+    PIDRing* ring = findRing(pid);
+    return ring != NULL ? ring->count.load(std::memory_order_acquire) : 0;
+}
+
+bool pidHistoryRead(uint8_t pid, uint32_t seq, PIDSample& sample) {
+    PIDRing* ring = findRing(pid);
+    if (ring == NULL) return false;
+
+    uint32_t count = ring->count.load(std::memory_order_acquire);
+    if (seq >= count || count - seq > PID_HISTORY_CAPACITY) return false;
+
+    sample = ring->samples[seq & (PID_HISTORY_CAPACITY - 1)];
+
+    // The writer starts overwriting this slot once count reaches seq + capacity
+    std::atomic_thread_fence(std::memory_order_acquire);
+    count = ring->count.load(std::memory_order_relaxed);
+    return count - seq < PID_HISTORY_CAPACITY;
+}
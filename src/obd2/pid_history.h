@@ -0,0 +1,63 @@
+/**
+ * PID History Module
+ *
+ * Recent decoded samples per live PID for trend views:
+ * - One fixed-capacity ring per PID (PID_HISTORY_CAPACITY samples, PSRAM if available)
+ * - Filled by the OBD2 task only (single producer, never blocks)
+ * - Readers address samples by sequence number (0 = first sample since boot)
+ *   and detect samples that were overwritten while being copied
+ */
+
+#ifndef PID_HISTORY_H
+#define PID_HISTORY_H
+
+#include <stdint.h>
+#include "config.h"
+
+static_assert((PID_HISTORY_CAPACITY & (PID_HISTORY_CAPACITY - 1)) == 0,
+              "PID_HISTORY_CAPACITY must be a power of two");
+
+/**
+ * One decoded sample
+ */
+struct PIDSample {
+    uint32_t time_ms;       // Request time (millis)
+    float value;            // Decoded value (same units as LiveData)
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Allocate the rings (call once before the OBD2 task starts)
+ * History stays empty (pushes are no-ops) if allocation fails
+ */
+void initPIDHistory();
+
+/**
+ * Append a sample (OBD2 task only, never blocks)
+ * PIDs without a ring are ignored
+ * @param pid Mode 01 PID
+ * @param value Decoded value
+ * @param time_ms Sample time (millis)
+ */
+void pidHistoryPush(uint8_t pid, float value, uint32_t time_ms);
+
+/**
+ * Number of samples pushed since boot (sequence number of the next sample)
+ * @param pid Mode 01 PID
+ * @return Sample count, 0 for PIDs without a ring
+ */
+uint32_t pidHistoryCount(uint8_t pid);
+
+/**
+ * Copy one sample by sequence number (any task, lock-free)
+ * @param pid Mode 01 PID
+ * @param seq Sequence number (valid range: count - PID_HISTORY_CAPACITY .. count - 1)
+ * @param sample Output
+ * @return false if the sample is not written yet or was overwritten
+ */
+bool pidHistoryRead(uint8_t pid, uint32_t seq, PIDSample& sample);
+
+#endif // PID_HISTORY_H
@@ -0,0 +1,181 @@
+/**
+ * PID Scheduler Module - Implementation
+ */
+
+#include "pid_scheduler.h"
+
+// ============================================================================
+// SCHEDULE TABLE
+// ============================================================================
+
+static PIDSchedule schedule[] = {
+    {PID_RPM,             PID_INTERVAL_RPM_MS,      PID_PRIORITY_RPM,      0, false, true},
+    {PID_SPEED,           PID_INTERVAL_SPEED_MS,    PID_PRIORITY_SPEED,    0, false, true},
+    {PID_THROTTLE,        PID_INTERVAL_THROTTLE_MS, PID_PRIORITY_THROTTLE, 0, false, true},
+    {PID_COOLANT_TEMP,    PID_INTERVAL_COOLANT_MS,  PID_PRIORITY_COOLANT,  0, false, true},
+    {PID_INTAKE_TEMP,     PID_INTERVAL_INTAKE_MS,   PID_PRIORITY_INTAKE,   0, false, true},
+    {PID_BATTERY_VOLTAGE, PID_INTERVAL_BATTERY_MS,  PID_PRIORITY_BATTERY,  0, false, true},
+    {PID_MAF,             PID_INTERVAL_MAF_MS,      PID_PRIORITY_MAF,      0, false, true},
+    {PID_MAP,             PID_INTERVAL_MAP_MS,      PID_PRIORITY_MAP,      0, false, true},
+    {PID_ENGINE_LOAD,     PID_INTERVAL_LOAD_MS,     PID_PRIORITY_LOAD,     0, false, true},
+    {PID_BARO,            PID_INTERVAL_BARO_MS,     PID_PRIORITY_BARO,     0, false, true},
+};
+static const uint8_t schedule_count = sizeof(schedule) / sizeof(schedule[0]);
+
+// Score for PIDs that were never polled (always first)
+static const uint32_t SCORE_NEVER_POLLED = 0xFFFFFFFF;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * Overdue score in eighths of the interval (8 = exactly due)
+ * Quantized so PIDs that are nearly equally overdue fall back to priority
+ */
+static uint32_t overdueScore(const PIDSchedule& entry, uint32_t now) {
+    if (!entry.polled) return SCORE_NEVER_POLLED;
+    uint32_t elapsed = now - entry.last_poll_ms;
+    return (elapsed * 8) / entry.interval_ms;
+}
+
+/**
+ * Time since the last request (unquantized, never polled = longest)
+ */
+static uint32_t waitingTime(const PIDSchedule& entry, uint32_t now) {
+    return entry.polled ? now - entry.last_poll_ms : 0xFFFFFFFF;
+}
+
+/**
+ * Whether entry a should be polled before entry b
+ */
+static bool isMoreUrgent(uint32_t score_a, uint8_t prio_a, uint32_t score_b, uint8_t prio_b) {
+    if (score_a != score_b) return score_a > score_b;
+    return prio_a > prio_b;
+}
+
+// ============================================================================
+// SCHEDULER FUNCTIONS
+// ============================================================================
+
+void initPIDScheduler() {
+    resetPIDScheduler();
+}
+
+void resetPIDScheduler() {
+    for (uint8_t i = 0; i < schedule_count; i++) {
+        schedule[i].polled = false;
+        schedule[i].last_poll_ms = 0;
+    }
+}
+
+void setPIDSupported(uint8_t pid, bool supported) {
+    for (uint8_t i = 0; i < schedule_count; i++) {
+        if (schedule[i].pid == pid) {
+            schedule[i].supported = supported;
+            return;
+        }
+    }
+}
+
+uint8_t selectDuePIDs(uint32_t now, uint8_t* pids, uint8_t max_pids) {
+    uint32_t scores[schedule_count];
+    bool taken[schedule_count];
+    bool any_due = false;
+
+    for (uint8_t i = 0; i < schedule_count; i++) {
+        scores[i] = schedule[i].supported ? overdueScore(schedule[i], now) : 0;
+        taken[i] = !schedule[i].supported;
+        if (scores[i] >= 8) any_due = true;
+    }
+
+    if (!any_due) return 0;
+
+    // Pick most urgent entries first (selection sort - table is tiny)
+    uint8_t selected = 0;
+    while (selected < max_pids) {
+        int best = -1;
+        for (uint8_t i = 0; i < schedule_count; i++) {
+            if (taken[i]) continue;
+            // Due PIDs, or nearly due ones riding along in the same request
+            uint32_t min_score = (selected == 0) ? 8 : 4;
+            if (scores[i] < min_score) continue;
+            if (best < 0 || isMoreUrgent(scores[i], schedule[i].priority,
+                                         scores[best], schedule[best].priority)) {
+                best = i;
+            }
+        }
+        if (best < 0) break;
+
+        taken[best] = true;
+        pids[selected++] = schedule[best].pid;
+    }
+
+    return selected;
+}
+
+uint8_t selectFocusPIDs(uint32_t now, const uint8_t* focus, uint8_t focus_count,
+                        uint8_t* pids, uint8_t max_pids) {
+    int8_t entries[OBD2_MAX_PIDS_PER_REQUEST];
+    uint8_t found = 0;
+
+    for (uint8_t f = 0; f < focus_count && found < OBD2_MAX_PIDS_PER_REQUEST; f++) {
+        for (uint8_t i = 0; i < schedule_count; i++) {
+            if (schedule[i].pid == focus[f] && schedule[i].supported) {
+                entries[found++] = i;
+                break;
+            }
+        }
+    }
+
+    // Longest waiting first (selection sort - stable for equal scores)
+    uint8_t selected = 0;
+    while (selected < max_pids && selected < found) {
+        uint8_t best = selected;
+        for (uint8_t j = selected + 1; j < found; j++) {
+            if (waitingTime(schedule[entries[j]], now) > waitingTime(schedule[entries[best]], now)) {
+                best = j;
+            }
+        }
+        int8_t entry = entries[best];
+        for (uint8_t j = best; j > selected; j--) {
+            entries[j] = entries[j - 1];
+        }
+        entries[selected] = entry;
+        pids[selected++] = schedule[entry].pid;
+    }
+
+    return selected;
+}
+
+void markPIDPolled(uint8_t pid, uint32_t now) {
+    for (uint8_t i = 0; i < schedule_count; i++) {
+        if (schedule[i].pid == pid) {
+            schedule[i].last_poll_ms = now;
+            schedule[i].polled = true;
+            return;
+        }
+    }
+}
+
+uint32_t getMsUntilNextDue(uint32_t now) {
+    uint32_t next = 0xFFFFFFFF;
+
+    for (uint8_t i = 0; i < schedule_count; i++) {
+        if (!schedule[i].supported) continue;
+        if (!schedule[i].polled) return 0;
+
+        uint32_t elapsed = now - schedule[i].last_poll_ms;
+        if (elapsed >= schedule[i].interval_ms) return 0;
+
+        uint32_t remaining = schedule[i].interval_ms - elapsed;
+        if (remaining < next) next = remaining;
+    }
+
+    return next;
+}
+
+const PIDSchedule* getPIDSchedule(uint8_t& count) {
+    count = schedule_count;
+    return schedule;
+}
@@ -0,0 +1,103 @@
+/**
+ * PID Scheduler Module
+ *
+ * Adaptive per-PID polling for the OBD2 task:
+ * - Each PID has a target interval and priority (config.h)
+ * - The most overdue PIDs are selected first
+ * - Batched requests are topped up with PIDs that are nearly due
+ * - PIDs the ECU does not support are never selected
+ * - Sport mode bypasses the intervals for a short focus list
+ *
+ * Time is passed in by the caller (millis()), no Arduino dependencies
+ */
+
+#ifndef PID_SCHEDULER_H
+#define PID_SCHEDULER_H
+
+#include <stdint.h>
+#include "config.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+struct PIDSchedule {
+    uint8_t pid;            // Mode 01 PID
+    uint16_t interval_ms;   // Target polling interval
+    uint8_t priority;       // 1=low, 3=high (tie-breaker)
+    uint32_t last_poll_ms;  // Time of last request
+    bool polled;            // Whether PID was requested since reset
+    bool supported;         // ECU reports PID as supported (true until discovery says otherwise)
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Initialize schedule table from config.h intervals/priorities
+ * All PIDs start overdue so the first pass polls everything
+ */
+void initPIDScheduler();
+
+/**
+ * Mark all PIDs overdue (call after reconnect)
+ */
+void resetPIDScheduler();
+
+/**
+ * Mark a PID as supported or unsupported by the ECU
+ * Unsupported PIDs are skipped by selectDuePIDs() and getMsUntilNextDue()
+ * Kept across resetPIDScheduler() (reconnects do not re-probe)
+ * @param pid Mode 01 PID
+ * @param supported Whether the ECU supports the PID
+ */
+void setPIDSupported(uint8_t pid, bool supported);
+
+/**
+ * Select PIDs to poll next, most overdue first
+ * If at least one PID is due, remaining slots are filled with PIDs that
+ * have passed half their interval (free ride in the same request)
+ * @param now Current time (ms)
+ * @param pids Output array of selected PIDs
+ * @param max_pids Capacity of pids (1 for single-PID mode)
+ * @return Number of PIDs selected (0 if nothing is due)
+ */
+uint8_t selectDuePIDs(uint32_t now, uint8_t* pids, uint8_t max_pids);
+
+/**
+ * Select PIDs from a fixed focus list, ignoring intervals (sport mode)
+ * Every supported focus PID is always due; least recently polled first,
+ * ties in list order - a full batch is the same request every time
+ * @param now Current time (ms)
+ * @param focus PIDs to poll
+ * @param focus_count Number of focus PIDs
+ * @param pids Output array of selected PIDs
+ * @param max_pids Capacity of pids (1 for single-PID mode)
+ * @return Number of PIDs selected (0 if none of them is supported)
+ */
+uint8_t selectFocusPIDs(uint32_t now, const uint8_t* focus, uint8_t focus_count,
+                        uint8_t* pids, uint8_t max_pids);
+
+/**
+ * Record that a PID was requested
+ * @param pid Mode 01 PID
+ * @param now Time of request (ms)
+ */
+void markPIDPolled(uint8_t pid, uint32_t now);
+
+/**
+ * Get time until the next PID becomes due
+ * @param now Current time (ms)
+ * @return Milliseconds until next due PID (0 if one is due now)
+ */
+uint32_t getMsUntilNextDue(uint32_t now);
+
+/**
+ * Get all PIDs known to the scheduler
+ * @param count Output: number of entries
+ * @return Schedule table (read-only)
+ */
+const PIDSchedule* getPIDSchedule(uint8_t& count);
+
+#endif // PID_SCHEDULER_H
@@ -0,0 +1,100 @@
+/**
+ * PID Support Module - Implementation
+ */
+
+#include "pid_support.h"
+#include <Preferences.h>
+
+// ============================================================================
+// BITMAPS
+// ============================================================================
+
+bool isPIDSupported(const SupportedPIDs& support, uint8_t pid) {
+    if (!support.valid || pid == 0) return true;
+
+    uint8_t range = (pid - 1) / 0x20;
+    if (range >= support.probed_ranges) return true;  // Not probed
+
+    uint8_t bit = 31 - ((pid - 1) % 0x20);
+    return (support.ranges[range] >> bit) & 1;
+}
+
+bool decodeSupportedPIDResponse(const ELMResponse& resp, uint8_t range_pid, uint32_t& bitmap) {
+    bool found = false;
+    bitmap = 0;
+
+    // One "41 [range] A B C D" message per ECU
+    for (int i = 0; i + 5 < resp.data_len; i++) {
+        if (resp.data[i] != 0x41 || resp.data[i + 1] != range_pid) continue;
+
+        bitmap |= ((uint32_t)resp.data[i + 2] << 24) | ((uint32_t)resp.data[i + 3] << 16) |
+                  ((uint32_t)resp.data[i + 4] << 8) | resp.data[i + 5];
+        found = true;
+        i += 5;
+    }
+    return found;
+}
+
+// ============================================================================
+// NVS CACHE
+// ============================================================================
+
+// Stored blob (VIN repeated to reject key hash collisions)
+struct SupportCacheEntry {
+    char vin[18];
+    uint8_t probed_ranges;
+    uint32_t ranges[PID_SUPPORT_RANGES];
+};
+
+/**
+ * NVS key for a VIN (keys are limited to 15 chars - use FNV-1a hash)
+ */
+static void cacheKey(const char* vin, char* key, size_t size) {
+    uint32_t hash = 2166136261UL;
+    for (const char* p = vin; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619UL;
+    }
+    snprintf(key, size, "pid%08lx", (unsigned long)hash);
+}
+
+bool loadSupportedPIDs(const char* vin, SupportedPIDs& support) {
+    char key[16];
+    cacheKey(vin, key, sizeof(key));
+
+    Preferences prefs;
+    if (!prefs.begin(PID_SUPPORT_NVS_NAMESPACE, true)) return false;
+
+    SupportCacheEntry entry;
+    bool found = prefs.getBytesLength(key) == sizeof(entry) &&
+                 prefs.getBytes(key, &entry, sizeof(entry)) == sizeof(entry) &&
+                 strncmp(entry.vin, vin, sizeof(entry.vin)) == 0 &&
+                 entry.probed_ranges > 0 && entry.probed_ranges <= PID_SUPPORT_RANGES;
+    prefs.end();
+
+    if (found) {
+        memcpy(support.ranges, entry.ranges, sizeof(support.ranges));
+        support.probed_ranges = entry.probed_ranges;
+        support.valid = true;
+        support.complete = true;
+    }
+    return found;
+}
+
+void saveSupportedPIDs(const char* vin, const SupportedPIDs& support) {
+    char key[16];
+    cacheKey(vin, key, sizeof(key));
+
+    SupportCacheEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.vin, vin, sizeof(entry.vin) - 1);
+    entry.probed_ranges = support.probed_ranges;
+    memcpy(entry.ranges, support.ranges, sizeof(entry.ranges));
+
+    Preferences prefs;
+    if (!prefs.begin(PID_SUPPORT_NVS_NAMESPACE, false)) {
+        Serial.println("[PIDs] NVS open failed - bitmaps not cached");
+        return;
+    }
+    prefs.putBytes(key, &entry, sizeof(entry));
+    prefs.end();
+}
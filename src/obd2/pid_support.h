@@ -0,0 +1,67 @@
+/**
+ * PID Support Module
+ *
+ * Supported-PID discovery for Mode 01:
+ * - Bitmaps from 0100 / 0120 / 0140 (PIDs 01-60), merged over all ECUs
+ * - Cached in NVS keyed by VIN, so later boots skip the probe
+ *
+ * Unsupported PIDs are removed from the polling schedule (pid_scheduler.h)
+ */
+
+#ifndef PID_SUPPORT_H
+#define PID_SUPPORT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "elm_parser.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+#define PID_SUPPORT_RANGES  3   // 0100 (01-20), 0120 (21-40), 0140 (41-60)
+
+/**
+ * Supported-PID bitmaps as sent by the ECU
+ * Bit 31 of ranges[r] = PID r*0x20 + 0x01, bit 0 = PID r*0x20 + 0x20
+ */
+struct SupportedPIDs {
+    uint32_t ranges[PID_SUPPORT_RANGES];
+    uint8_t probed_ranges;  // Ranges known (read, or ruled out by a clear "next range" bit)
+    bool valid;             // Bitmaps were read (from ECU or cache)
+    bool complete;          // Probe ended on a clear "next range" bit, not a failure (safe to cache)
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Check if a PID is marked supported
+ * PIDs outside the probed ranges (beyond 0x60, or above a probe that failed),
+ * or any PID when bitmaps are invalid, count as supported
+ */
+bool isPIDSupported(const SupportedPIDs& support, uint8_t pid);
+
+/**
+ * Decode a supported-PID reply ("41 00 BE 3E B8 11"), OR-ing replies of all ECUs
+ * @param resp Parsed response
+ * @param range_pid Requested PID (0x00, 0x20 or 0x40)
+ * @param bitmap Output bitmap
+ * @return true if at least one ECU answered
+ */
+bool decodeSupportedPIDResponse(const ELMResponse& resp, uint8_t range_pid, uint32_t& bitmap);
+
+/**
+ * Load cached bitmaps for a VIN from NVS
+ * @return true if a cache entry for this VIN exists
+ */
+bool loadSupportedPIDs(const char* vin, SupportedPIDs& support);
+
+/**
+ * Store bitmaps for a VIN in NVS
+ * Only for complete probes - a glitch must not disable PIDs on later boots
+ */
+void saveSupportedPIDs(const char* vin, const SupportedPIDs& support);
+
+#endif // PID_SUPPORT_H
@@ -0,0 +1,91 @@
+/**
+ * SeqLock - Lock-free single-writer snapshot
+ *
+ * Publishes a plain struct from one writer task to any number of readers
+ * without a mutex:
+ * - Writer bumps the sequence to odd, copies the data, bumps it to even
+ * - Readers copy the data and retry if the sequence changed meanwhile
+ * - Readers never block the writer; the writer never waits for readers
+ *
+ * Only ONE task may call write() for a given SeqLock.
+ * Reader retries are counted (retryCount) to show contention in the metrics.
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+template <typename T>
+class SeqLock {
+public:
+    SeqLock() : sequence_(0), retries_(0) {
+        memset(&data_, 0, sizeof(T));
+    }
+
+    /**
+     * Publish a new value (single writer only)
+     */
+    void write(const T& value) {
+        uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&data_, &value, sizeof(T));
+
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * Copy a consistent snapshot (lock-free, retries while a write is in progress)
+     * @param out Destination
+     * @return Version of the snapshot that was copied
+     */
+    uint32_t read(T& out) const {
+        uint32_t before, after;
+        while (true) {
+            before = sequence_.load(std::memory_order_acquire);
+            memcpy(&out, &data_, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence_.load(std::memory_order_relaxed);
+            if (!(before & 1) && before == after) break;
+            retries_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return before;
+    }
+
+    /**
+     * Copy snapshot only if it changed since last_version
+     * @param out Destination (untouched if unchanged)
+     * @param last_version In: version of out, Out: new version
+     * @return true if out was updated
+     */
+    bool readIfChanged(T& out, uint32_t& last_version) const {
+        if (version() == last_version) return false;
+        last_version = read(out);
+        return true;
+    }
+
+    /**
+     * Current version (changes on every write)
+     */
+    uint32_t version() const {
+        return sequence_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Number of reads that had to retry because a write was in progress
+     */
+    uint32_t retryCount() const {
+        return retries_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> sequence_;
+    mutable std::atomic<uint32_t> retries_;
+    T data_;
+};
+
+#endif // SEQLOCK_H
@@ -0,0 +1,200 @@
+/**
+ * Warm-Start Cache Module - Implementation
+ */
+
+#include "warm_start.h"
+#include <Preferences.h>
+
+#define WARM_START_KEY  "state"
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+// Snapshot found at boot (written in setup() only)
+static WarmStartState boot_state;
+
+// Last snapshot in NVS, and the candidate waiting to settle (input loop only)
+static WarmStartState stored_state;
+static WarmStartState pending_state;
+static bool has_pending = false;
+static uint32_t pending_since = 0;
+static uint32_t last_write_ms = 0;
+static bool has_written = false;
+
+// Set by the OBD2 task, read by the input loop
+static std::atomic<bool> batch_supported(OBD2_BATCH_QUERIES);
+
+/**
+ * Defaults for a first boot (nothing cached)
+ */
+static void initWarmStartState(WarmStartState& state) {
+    memset(&state, 0, sizeof(state));
+    state.version = WARM_START_VERSION;
+    state.batch_supported = OBD2_BATCH_QUERIES;
+}
+
+// ============================================================================
+// BOOT
+// ============================================================================
+
+bool loadWarmStartCache() {
+    initWarmStartState(boot_state);
+
+    Preferences prefs;
+    bool found = false;
+    if (prefs.begin(WARM_START_NVS_NAMESPACE, true)) {
+        WarmStartState state;
+        found = prefs.getBytesLength(WARM_START_KEY) == sizeof(state) &&
+                prefs.getBytes(WARM_START_KEY, &state, sizeof(state)) == sizeof(state) &&
+                state.version == WARM_START_VERSION;
+        prefs.end();
+
+        if (found) {
+            memcpy(&boot_state, &state, sizeof(state));
+            boot_state.vin[sizeof(boot_state.vin) - 1] = '\0';
+            boot_state.adapter[sizeof(boot_state.adapter) - 1] = '\0';
+            if (boot_state.dtc_count > MAX_DTC_CODES) boot_state.dtc_count = MAX_DTC_CODES;
+        }
+    }
+
+    memcpy(&stored_state, &boot_state, sizeof(stored_state));
+    batch_supported.store(boot_state.batch_supported);
+
+    if (found) {
+        Serial.printf("[Warm] Cached VIN %s, %d DTCs, page %d, layout %d\n",
+                      boot_state.vin[0] ? boot_state.vin : "(none)", boot_state.dtc_count,
+                      boot_state.page, boot_state.layout);
+    } else {
+        Serial.println("[Warm] No warm-start cache - cold start");
+    }
+    return found;
+}
+
+const WarmStartState& getWarmStartBoot() {
+    return boot_state;
+}
+
+bool fillVehicleInfoFromWarmStart(VehicleInfo& info) {
+    if (boot_state.vin[0] == '\0') return false;
+
+    snprintf(info.vin, sizeof(info.vin), "%s", boot_state.vin);
+    info.vin_fetched = true;
+    info.vin_cached = true;
+
+    if (boot_state.adapter[0] != '\0') {
+        snprintf(info.adapter, sizeof(info.adapter), "%s", boot_state.adapter);
+        info.adapter_clone = boot_state.adapter_clone;
+    }
+
+    if (boot_state.dtc_valid) {
+        for (uint8_t i = 0; i < boot_state.dtc_count; i++) {
+            DTC& dtc = info.dtc_codes[i];
+            dtc.raw = boot_state.dtc_raw[i];
+            parseDTC(dtc.raw, dtc.code);
+            dtc.description = getDTCDescription(dtc.raw);
+            dtc.severity = getDTCSeverity(dtc.raw);
+            dtc.status = boot_state.dtc_status[i];
+        }
+        info.dtc_count = boot_state.dtc_count;
+        info.dtc_fetched = true;
+    }
+    return true;
+}
+
+void setWarmStartBatchSupported(bool supported) {
+    batch_supported.store(supported);
+}
+
+// ============================================================================
+// LAZY WRITE
+// ============================================================================
+
+/**
+ * Snapshot of the current state, starting from the stored one
+ * Fields only replace the stored values once the ECU/adapter confirmed them
+ */
+static void captureWarmStartState(const VehicleInfo& info, uint8_t page, uint8_t layout,
+                                  WarmStartState& state) {
+    memcpy(&state, &stored_state, sizeof(state));
+
+    bool vin_changed = false;
+    if (info.vin_fetched && !info.vin_cached) {
+        vin_changed = strcmp(state.vin, info.vin) != 0;
+        strncpy(state.vin, info.vin, sizeof(state.vin) - 1);  // Zero-padded (memcmp)
+    }
+
+    if (info.adapter[0] != '\0') {
+        strncpy(state.adapter, info.adapter, sizeof(state.adapter) - 1);
+        state.adapter_clone = info.adapter_clone;
+    }
+    state.batch_supported = batch_supported.load();
+
+    if (info.dtc_fetched) {
+        state.dtc_valid = true;
+        state.dtc_count = info.dtc_count;
+        for (uint8_t i = 0; i < info.dtc_count; i++) {
+            state.dtc_raw[i] = info.dtc_codes[i].raw;
+            state.dtc_status[i] = info.dtc_codes[i].status;
+        }
+    } else if (vin_changed) {
+        state.dtc_valid = false;  // Codes belong to the previous vehicle
+        state.dtc_count = 0;
+    }
+
+    // Unused slots stay zero, so equal states compare equal byte for byte
+    for (uint8_t i = state.dtc_count; i < MAX_DTC_CODES; i++) {
+        state.dtc_raw[i] = 0;
+        state.dtc_status[i] = 0;
+    }
+
+    state.page = page;
+    state.layout = layout;
+}
+
+/**
+ * Store a snapshot in NVS
+ */
+static bool writeWarmStartState(const WarmStartState& state) {
+    Preferences prefs;
+    if (!prefs.begin(WARM_START_NVS_NAMESPACE, false)) {
+        Serial.println("[Warm] NVS open failed - state not cached");
+        return false;
+    }
+    bool ok = prefs.putBytes(WARM_START_KEY, &state, sizeof(state)) == sizeof(state);
+    prefs.end();
+    return ok;
+}
+
+void serviceWarmStartCache(const VehicleInfo& info, uint8_t page, uint8_t layout, uint32_t now) {
+    WarmStartState current;
+    captureWarmStartState(info, page, layout, current);
+
+    // Back to the stored state - nothing to write
+    if (memcmp(&current, &stored_state, sizeof(current)) == 0) {
+        has_pending = false;
+        return;
+    }
+
+    // New change: restart the settle time (bursts become one write)
+    if (!has_pending || memcmp(&current, &pending_state, sizeof(current)) != 0) {
+        memcpy(&pending_state, &current, sizeof(current));
+        pending_since = now;
+        has_pending = true;
+        return;
+    }
+
+    if (now - pending_since < WARM_START_SETTLE_MS) return;
+    if (has_written && now - last_write_ms < WARM_START_MIN_INTERVAL_MS) return;
+
+    uint32_t start = millis();
+    if (writeWarmStartState(current)) {
+        Serial.printf("[Warm] State cached (%u bytes, %lu ms)\n",
+                      (unsigned)sizeof(current), (unsigned long)(millis() - start));
+        memcpy(&stored_state, &current, sizeof(current));
+        has_pending = false;
+    }
+    // A failed write is retried after the interval, like the next change
+    last_write_ms = now;
+    has_written = true;
+}
@@ -0,0 +1,88 @@
+/**
+ * Warm-Start Cache Module
+ *
+ * Last known vehicle state persisted in NVS (one small blob), so a boot
+ * does not start from nothing:
+ * - VIN: the supported-PID bitmaps of that VIN (pid_support.h) are used
+ *   before the VIN is queried again; the query moves after the first poll
+ * - Adapter identity and batch capability (no failed multi-PID probe per boot)
+ * - Last DTC list (raw codes and status, descriptions rebuilt from dtc_table.h)
+ * - Last page and dashboard layout
+ *
+ * Written lazily by the input loop: only when the state differs from the
+ * stored blob, after WARM_START_SETTLE_MS without further changes and at
+ * most once per WARM_START_MIN_INTERVAL_MS (NVS flash wear)
+ */
+
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "obd_data.h"
+
+// ============================================================================
+// DATA STRUCTURES
+// ============================================================================
+
+#define WARM_START_VERSION  1   // Bump when WarmStartState changes (old blobs are ignored)
+
+/**
+ * Persisted snapshot (stored as one NVS blob)
+ * Field order leaves no padding - snapshots are compared with memcmp()
+ */
+struct WarmStartState {
+    uint8_t version;                    // WARM_START_VERSION
+    uint8_t page;                       // Page (ui_common.h)
+    uint8_t layout;                     // Dashboard layout index
+    bool adapter_clone;                 // Clone detected
+    bool batch_supported;               // ECU accepted multi-PID requests
+    bool dtc_valid;                     // DTC list below was read from the ECU
+    uint8_t dtc_count;
+    uint8_t reserved;
+    char vin[18];                       // Last confirmed VIN ("" = none)
+    char adapter[24];                   // ATI reply of the last adapter
+    uint16_t dtc_raw[MAX_DTC_CODES];    // Raw 2-byte codes
+    uint8_t dtc_status[MAX_DTC_CODES];  // DTC_STATUS_* flags
+};
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Read the stored snapshot (call once in setup(), before the tasks start)
+ * @return true if a snapshot of this version was found
+ */
+bool loadWarmStartCache();
+
+/**
+ * Snapshot read at boot (zeroed defaults if none was stored)
+ * Constant after loadWarmStartCache(), safe to read from any task
+ */
+const WarmStartState& getWarmStartBoot();
+
+/**
+ * Pre-populate the cold block from the boot snapshot
+ * The VIN is marked vin_cached until the OBD2 task confirms it
+ * @param info Vehicle info to fill (unchanged without a cached VIN)
+ * @return true if a VIN was cached
+ */
+bool fillVehicleInfoFromWarmStart(VehicleInfo& info);
+
+/**
+ * Report the batch capability (OBD2 task, on change)
+ */
+void setWarmStartBatchSupported(bool supported);
+
+/**
+ * Persist the current state once it settled (input loop, every wake-up)
+ * Unconfirmed cached values never replace the stored ones
+ * @param info Latest cold block copy
+ * @param page Current page
+ * @param layout Active dashboard layout
+ * @param now Current time (ms)
+ */
+void serviceWarmStartCache(const VehicleInfo& info, uint8_t page, uint8_t layout, uint32_t now);
+
+#endif // WARM_START_H
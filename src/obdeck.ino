@@ -9,7 +9,7 @@
  *
  * Architecture:
  * - Core 0: OBD2 communication task (obd2/obd2_task.cpp)
- * - Core 1: Display rendering (main loop)
+ * - Core 1: Display task (display/display_manager.cpp) + input handling (main loop)
  *
  * Author: OBDeck Project
  * Platform: PlatformIO + Arduino Framework
@@ -21,11 +21,22 @@
 
 // OBD2 Communication Module
 #include "obd2/obd2_task.h"
+#include "obd2/warm_start.h"
 
 // Display Manager
 #include "display/display_manager.h"
 #include "display/button_nav.h"
-#include "display/startup_screen.h"
+#include "display/dashboard_layout.h"
+
+// Runtime metrics (stats page, serial dump)
+#include "metrics/metrics.h"
+#include "metrics/profiler.h"
+
+// Trip data logger (LittleFS)
+#include "logger/trip_logger.h"
+
+// Wi-Fi telemetry stream (optional)
+#include "telemetry/telemetry.h"
 
 // ============================================================================
 // GLOBAL STATE
@@ -41,6 +52,59 @@ bool page_needs_redraw = true;
 // Button navigation state (shared across all modules)
 int current_button_index = 0;  // Start with Dashboard button highlighted
 
+// UI button table (positions must match page drawing code)
+UIButton ui_buttons[BTN_MAX] = {
+    // Bottom Navigation (always visible on all pages)
+    {BTN_NAV_DASHBOARD, 0,   BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},  // Page 99 = always visible
+    {BTN_NAV_DTC,       160, BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},
+    {BTN_NAV_CONFIG,    320, BOTTOM_NAV_Y, NAV_BUTTON_WIDTH, BOTTOM_NAV_HEIGHT, true, (Page)99},
+
+    // DTC Page Buttons (only visible on DTC page)
+    {BTN_DTC_DETAIL,  DTC_DETAIL_BTN_X, CONTENT_Y_START + 3, DTC_DETAIL_BTN_W, 26, false, PAGE_DTC},  // Enabled dynamically
+    {BTN_DTC_REFRESH, 290, CONTENT_Y_START + 3, 90, 26, true, PAGE_DTC},
+    {BTN_DTC_CLEAR,   390, CONTENT_Y_START + 3, 85, 26, true, PAGE_DTC},
+    {BTN_DTC_UP,      80,  BOTTOM_NAV_Y - 48, 140, 38, false, PAGE_DTC},  // Enabled dynamically
+    {BTN_DTC_DOWN,    260, BOTTOM_NAV_Y - 48, 140, 38, false, PAGE_DTC},  // Enabled dynamically
+
+    // Config Page Buttons
+    {BTN_CONFIG_SPORT, 250, CONTENT_Y_START + 175, 200, 38, false, PAGE_CONFIG},  // Sport mode toggle
+};
+
+// DTC list scroll position (first visible DTC)
+int dtc_scroll_offset = 0;
+
+// DTC detail view (code shown, -1 = list)
+int dtc_detail_index = -1;
+
+// ============================================================================
+// WARM START
+// ============================================================================
+
+/**
+ * Open the page and dashboard layout of the last session (warm-start cache)
+ * Hidden pages are not restored - their nav tab opens instead
+ */
+static void restoreLastPage() {
+    const WarmStartState& state = getWarmStartBoot();
+    setActiveDashboardLayout(state.layout);
+
+    switch (state.page) {
+        case PAGE_DTC:
+            current_page = PAGE_DTC;
+            current_button_index = BTN_NAV_DTC;
+            break;
+        case PAGE_CONFIG:
+        case PAGE_STATS:
+            current_page = PAGE_CONFIG;
+            current_button_index = BTN_NAV_CONFIG;
+            break;
+        default:
+            current_page = PAGE_DASHBOARD;
+            current_button_index = BTN_NAV_DASHBOARD;
+            break;
+    }
+}
+
 // ============================================================================
 // ARDUINO SETUP & LOOP
 // ============================================================================
@@ -59,6 +123,9 @@ void setup() {
       Serial.println("OBD2: ELM327 Bluetooth");
       Serial.println("========================================\n");
 
+      // Last vehicle state and page from NVS (pre-populates the OBD2 data)
+      loadWarmStartCache();
+
       // Initialize OBD2 module (creates mutex and initializes Bluetooth)
       initOBD2();
 
@@ -69,10 +136,16 @@ void setup() {
       // Initialize physical button navigation
       initButtonNav();
 
-      // Show animated startup screen (~3 seconds)
-      showStartupScreen();
+      // Dashboard layouts (built-in, or /layouts.json on LittleFS)
+      loadDashboardLayouts();
+
+      // Back to the last page and layout (hidden pages open their nav tab)
+      restoreLastPage();
 
-      // Start OBD2 task on Core 0
+      // Start trip logger (mounts LittleFS, opens this boot's trip file)
+      startTripLogger();
+
+      // Start OBD2 task on Core 0 first - it connects while the startup screen animates
       xTaskCreatePinnedToCore(
           obd2Task,                // Task function
           "OBD2Task",              // Task name
@@ -84,41 +157,59 @@ void setup() {
       );
 
       Serial.println("✓ OBD2 task started on Core 0");
+
+      // Start display task on Core 1 (owns the TFT from here on, steps the startup screen)
+      startDisplayTask();
+      Serial.println("✓ Display task started on Core 1");
+
+      // Optional Wi-Fi telemetry stream (TELEMETRY_ENABLED, lowest priority)
+      startTelemetry();
+
       Serial.println("\nSetup complete! Entering main loop...\n");
   }
 
 void loop() {
-    // Display task runs on Core 1 (main loop)
-    static unsigned long last_update = 0;
-    static bool first_draw = true;
+    // Input loop on Core 1 - drawing happens in the display task
     static bool loop_started = false;
+    static VehicleInfo info;
+    static uint32_t info_version = 0;
 
     // Debug: Confirm loop is running
     if (!loop_started) {
-        Serial.println("[Loop] Main loop started on Core 1");
-        Serial.printf("[Loop] millis=%lu, DISPLAY_REFRESH_MS=%d\n", millis(), DISPLAY_REFRESH_MS);
+        Serial.println("[Loop] Input loop started on Core 1");
         loop_started = true;
     }
 
+    // DTC count drives button visibility (copied only when DTCs changed)
+    vehicle_info.readIfChanged(info, info_version);
+    updateButtonVisibility(current_page, info.dtc_count, dtc_scroll_offset);
+
     // Handle physical button input for navigation
-    OBDData data_copy_buttons;
-    xSemaphoreTake(data_mutex, portMAX_DELAY);
-    data_copy_buttons = obd_data;
-    xSemaphoreGive(data_mutex);
-    handleButtonInput(current_page, page_needs_redraw, data_copy_buttons.dtc_count);
-
-    // Force immediate first draw to clear startup screen
-    if (first_draw) {
-        Serial.println("[Display] First draw - clearing startup screen");
-        drawCurrentPage(current_page, page_needs_redraw);
-        last_update = millis();
-        first_draw = false;
+    handleButtonInput(current_page, page_needs_redraw, info.dtc_count);
+
+    // Hand page changes to the display task (DTC scrolls are queued by the button handler)
+    if (page_needs_redraw) {
+        requestPageRedraw(current_page);
+        page_needs_redraw = false;
     }
-    // Update display at refresh rate
-    else if (millis() - last_update >= DISPLAY_REFRESH_MS) {
-        drawCurrentPage(current_page, page_needs_redraw);
-        last_update = millis();
+
+    // Metrics dump on demand (send METRICS_DUMP_KEY over serial)
+    while (Serial.available() > 0) {
+        if (Serial.read() == METRICS_DUMP_KEY) {
+            metricsDump();
+        }
     }
 
-    delay(10);  // Small delay to prevent WDT issues
+    // Page, layout and vehicle state go to NVS once they settled
+    serviceWarmStartCache(info, current_page, getActiveDashboardLayout(), millis());
+
+    // Task CPU/stack and heap sample (stats page tasks view, serial summary line)
+    serviceProfiler(millis());
+
+    // Sleep until a button interrupt (or the idle wake-up for DTC count and serial keys)
+    // Idle wake-ups that come late show how long Core 1 kept the input loop waiting
+    uint32_t sleep_start = micros();
+    if (!waitForButtonInput(BTN_IDLE_WAKE_MS)) {
+        profilerRecordLoopWake(micros() - sleep_start);
+    }
 }
@@ -0,0 +1,240 @@
+/**
+ * Mock BluetoothSerial - Implementation
+ */
+
+#include "BluetoothSerial.h"
+#include "sim_clock.h"
+#include <string.h>
+
+static const char UNKNOWN_REPLY[] = "?\r\r>";
+
+BluetoothSerial::BluetoothSerial()
+    : text_len(0), exchange_count(0), cmd_len(0), last_served(-1),
+      reply(NULL), reply_len(0), reply_sent(0), reply_start_us(0),
+      latency_us(0), jitter_us(0), byte_us(0), random_state(1),
+      unknown_commands(0), link_up(false) {
+    text[0] = '\0';
+}
+
+// ============================================================================
+// BLUETOOTHSERIAL INTERFACE
+// ============================================================================
+
+bool BluetoothSerial::begin(const char* name, bool is_master) {
+    (void)name;
+    (void)is_master;
+    return true;
+}
+
+bool BluetoothSerial::connect(const char* name) {
+    (void)name;
+    link_up = true;
+    return true;
+}
+
+bool BluetoothSerial::connected() const {
+    return link_up;
+}
+
+void BluetoothSerial::disconnect() {
+    link_up = false;
+    reply = NULL;
+    cmd_len = 0;
+}
+
+int BluetoothSerial::available() {
+    if (reply == NULL) return 0;
+
+    uint64_t now = simNowUs();
+    if (now < reply_start_us) return 0;
+
+    uint64_t arrived = reply_len;
+    if (byte_us > 0) {
+        arrived = 1 + (now - reply_start_us) / byte_us;
+        if (arrived > reply_len) arrived = reply_len;
+    }
+    return (int)(arrived - reply_sent);
+}
+
+int BluetoothSerial::read() {
+    if (available() <= 0) return -1;
+
+    char c = reply[reply_sent++];
+    if (reply_sent == reply_len) reply = NULL;
+    return (uint8_t)c;
+}
+
+size_t BluetoothSerial::write(uint8_t c) {
+    if (!link_up) return 0;
+
+    if (c == '\r') {
+        cmd[cmd_len] = '\0';
+        startReply(cmd);
+        cmd_len = 0;
+    } else if (c != '\n' && cmd_len < SIM_CMD_LEN - 1) {
+        cmd[cmd_len++] = (char)c;
+    }
+    return 1;
+}
+
+size_t BluetoothSerial::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    for (size_t i = 0; i < size; i++) {
+        written += write(buffer[i]);
+    }
+    return written;
+}
+
+// ============================================================================
+// SIMULATION CONTROL
+// ============================================================================
+
+int BluetoothSerial::loadTranscript(const char* source) {
+    text_len = 0;
+    exchange_count = 0;
+    reply = NULL;
+    unknown_commands = 0;
+
+    Exchange* current = NULL;
+    const char* line = source;
+
+    while (*line != '\0') {
+        const char* end = strchr(line, '\n');
+        size_t len = end != NULL ? (size_t)(end - line) : strlen(line);
+        const char* next = end != NULL ? end + 1 : line + len;
+        while (len > 0 && (line[len - 1] == '\r' || line[len - 1] == ' ')) len--;
+
+        if (len == 0 || line[0] == '#') {
+            line = next;
+            continue;
+        }
+
+        // Room for this line plus the "\r\r>" that closes a reply
+        if (text_len + len + 4 >= SIM_MAX_TEXT) return -1;
+
+        if (line[0] == '>') {
+            // Close the previous reply, then start a new exchange
+            if (current != NULL) {
+                memcpy(text + text_len, "\r>", 2);
+                text_len += 2;
+                current->reply_len = text_len - current->reply;
+            }
+            if (exchange_count >= SIM_MAX_EXCHANGES) return -1;
+
+            const char* cmd_text = line + 1;
+            size_t cmd_text_len = len - 1;
+            while (cmd_text_len > 0 && *cmd_text == ' ') {
+                cmd_text++;
+                cmd_text_len--;
+            }
+            if (cmd_text_len >= SIM_CMD_LEN) return -1;
+
+            current = &exchanges[exchange_count++];
+            current->cmd = text_len;
+            memcpy(text + text_len, cmd_text, cmd_text_len);
+            text_len += cmd_text_len;
+            text[text_len++] = '\0';
+            current->reply = text_len;
+            current->reply_len = 0;
+        } else if (current != NULL) {
+            // Reply line (ELM327 ends every line with CR)
+            memcpy(text + text_len, line, len);
+            text_len += len;
+            text[text_len++] = '\r';
+        }
+        line = next;
+    }
+
+    if (current != NULL) {
+        memcpy(text + text_len, "\r>", 2);
+        text_len += 2;
+        current->reply_len = text_len - current->reply;
+    }
+
+    // Chain the entries of each command (replay order = transcript order)
+    for (uint16_t i = 0; i < exchange_count; i++) {
+        exchanges[i].next_same = i;
+        for (uint16_t n = 1; n < exchange_count; n++) {
+            uint16_t j = (i + n) % exchange_count;
+            if (strcmp(text + exchanges[j].cmd, text + exchanges[i].cmd) == 0) {
+                exchanges[i].next_same = j;
+                break;
+            }
+        }
+    }
+    rewind();
+    return exchange_count;
+}
+
+void BluetoothSerial::rewind() {
+    for (uint16_t i = 0; i < exchange_count; i++) {
+        exchanges[i].cursor = i;
+    }
+    reply = NULL;
+    cmd_len = 0;
+    last_served = -1;
+}
+
+void BluetoothSerial::setLatency(uint32_t latency, uint32_t jitter) {
+    latency_us = latency;
+    jitter_us = jitter;
+}
+
+void BluetoothSerial::setByteTime(uint32_t us) {
+    byte_us = us;
+}
+
+void BluetoothSerial::setSeed(uint32_t seed) {
+    random_state = seed != 0 ? seed : 1;
+}
+
+const char* BluetoothSerial::exchangeCommand(uint16_t index) const {
+    return index < exchange_count ? text + exchanges[index].cmd : "";
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+uint32_t BluetoothSerial::nextRandom() {
+    // xorshift32 (reproducible, no libc state)
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+void BluetoothSerial::startReply(const char* command) {
+    reply = UNKNOWN_REPLY;
+    reply_len = sizeof(UNKNOWN_REPLY) - 1;
+    uint32_t tx_bytes = (uint32_t)strlen(command) + 1;  // Including the CR
+
+    // Bare CR: the adapter repeats its last command
+    const char* lookup = command;
+    if (command[0] == '\0' && last_served >= 0) {
+        lookup = text + exchanges[last_served].cmd;
+    }
+
+    // First entry of the command holds the replay position of all its entries
+    bool found = false;
+    for (uint16_t i = 0; i < exchange_count; i++) {
+        if (strcmp(text + exchanges[i].cmd, lookup) == 0) {
+            Exchange& served = exchanges[exchanges[i].cursor];
+            reply = text + served.reply;
+            reply_len = served.reply_len;
+            exchanges[i].cursor = served.next_same;
+            last_served = i;
+            found = true;
+            break;
+        }
+    }
+    if (!found) unknown_commands++;
+
+    int64_t delay = latency_us + (int64_t)tx_bytes * byte_us;
+    if (jitter_us > 0) {
+        delay += (int64_t)(nextRandom() % (2 * jitter_us + 1)) - jitter_us;
+        if (delay < 0) delay = 0;
+    }
+    reply_sent = 0;
+    reply_start_us = simNowUs() + (uint64_t)delay;
+}
@@ -0,0 +1,118 @@
+/**
+ * Mock BluetoothSerial (host simulation build)
+ *
+ * Stands in for the ESP32 SPP link to an ELM327 adapter:
+ * - Replays a recorded transcript ("> CMD" lines followed by reply lines)
+ * - Each command is answered with its next transcript entry (per command,
+ *   wrapping), so repeated queries walk through changing values
+ * - Reply bytes arrive on the simulated clock: first byte after the
+ *   command bytes went out and the adapter latency (+/- jitter), then
+ *   one byte per byte time
+ * - A bare CR repeats the last answered command (ELM327 repeat)
+ * - Unknown commands are answered with "?" like a real adapter
+ *
+ * The transcript is parsed once by loadTranscript(); sending and
+ * receiving never allocates.
+ */
+
+#ifndef SIM_BLUETOOTH_SERIAL_H
+#define SIM_BLUETOOTH_SERIAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SIM_MAX_EXCHANGES   256    // Transcript entries
+#define SIM_MAX_TEXT        16384  // Transcript commands and replies (bytes)
+#define SIM_CMD_LEN         32     // Longest command
+
+class BluetoothSerial {
+public:
+    BluetoothSerial();
+
+    // ------------------------------------------------------------------------
+    // Subset of the ESP32 BluetoothSerial interface used by the transport
+    // ------------------------------------------------------------------------
+
+    bool begin(const char* name, bool is_master = false);
+    bool connect(const char* name);
+    bool connected() const;
+    void disconnect();
+
+    int available();
+    int read();
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+
+    // ------------------------------------------------------------------------
+    // Simulation control
+    // ------------------------------------------------------------------------
+
+    /**
+     * Load a transcript (replaces the previous one, rewinds the replay)
+     * @param text Transcript text ('#' starts a comment line)
+     * @return Number of exchanges loaded, or -1 if the transcript does not fit
+     */
+    int loadTranscript(const char* text);
+
+    /**
+     * Restart the replay (each command is answered with its first entry again)
+     */
+    void rewind();
+
+    /**
+     * Adapter response time
+     * @param latency_us Time from CR to the first reply byte
+     * @param jitter_us Maximum random deviation (+/-) from latency_us
+     */
+    void setLatency(uint32_t latency_us, uint32_t jitter_us);
+
+    /**
+     * Time per byte in either direction (SPP throughput)
+     */
+    void setByteTime(uint32_t byte_us);
+
+    /**
+     * Seed of the jitter generator (runs are reproducible per seed)
+     */
+    void setSeed(uint32_t seed);
+
+    uint16_t exchangeCount() const { return exchange_count; }
+    const char* exchangeCommand(uint16_t index) const;
+
+    uint32_t unknownCommands() const { return unknown_commands; }
+
+private:
+    struct Exchange {
+        uint16_t cmd;       // Offset of the command in text
+        uint16_t reply;     // Offset of the reply in text ("...\r\r>")
+        uint16_t reply_len;
+        uint16_t next_same; // Next exchange with the same command (cyclic)
+        uint16_t cursor;    // First of its command: exchange served next
+    };
+
+    void startReply(const char* cmd);
+    uint32_t nextRandom();
+
+    char text[SIM_MAX_TEXT];
+    uint16_t text_len;
+    Exchange exchanges[SIM_MAX_EXCHANGES];
+    uint16_t exchange_count;
+
+    char cmd[SIM_CMD_LEN];          // Command being received (up to CR)
+    uint8_t cmd_len;
+    int16_t last_served;            // First exchange of the last answered command (-1 = none)
+
+    const char* reply;              // Reply on the wire (NULL = idle)
+    uint16_t reply_len;
+    uint16_t reply_sent;            // Bytes already returned by read()
+    uint64_t reply_start_us;        // Arrival time of the first byte
+
+    uint32_t latency_us;
+    uint32_t jitter_us;
+    uint32_t byte_us;
+    uint32_t random_state;
+    uint32_t unknown_commands;
+    bool link_up;
+};
+
+#endif // SIM_BLUETOOTH_SERIAL_H
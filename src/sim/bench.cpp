@@ -0,0 +1,629 @@
+/**
+ * Host Simulation - Mock ELM327 replay and benchmarks
+ *
+ * Runs the allocation-free parser (elm_parser.cpp), the DTC table and the
+ * dashboard redraw decision (metric_format.h, dirty_rect.h) on the host,
+ * fed by the mock BluetoothSerial link:
+ * - Link replay: adapter setup, then the fast/slow poll batches on their
+ *   PID intervals for a span of simulated time; reports round trips per
+ *   command and the achieved sample rate for the given latency/jitter
+ *   (--sport: the fast batch back to back, repeated with a bare CR)
+ * - Parse cost: host ns per response (feed, parse, decode)
+ * - Allocations per query (operator new calls on the query path)
+ * - Redraw bytes per frame: the built-in "Dashboard" layout driven by the
+ *   replayed values, against the full-box redraw and the pixel budget
+ * - Digit atlas: coverage bytes and host rasterization time per text size
+ *
+ * Build and run: pio run -e native && .pio/build/native/program --help
+ */
+
+#include <chrono>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "obd2/elm_parser.h"
+#include "obd2/dtc_table.h"
+#include "display/metric_format.h"
+#include "display/dirty_rect.h"
+#include "display/digit_glyphs.h"
+#include "BluetoothSerial.h"
+#include "sim_clock.h"
+#include "transcript_corsa.h"
+
+// ============================================================================
+// ALLOCATION COUNTER
+// ============================================================================
+
+static uint64_t allocation_count = 0;
+
+void* operator new(size_t size) {
+    allocation_count++;
+    void* ptr = malloc(size != 0 ? size : 1);
+    if (ptr == NULL) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    allocation_count++;
+    void* ptr = malloc(size != 0 ? size : 1);
+    if (ptr == NULL) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+// ============================================================================
+// OPTIONS
+// ============================================================================
+
+struct SimOptions {
+    const char* transcript_file;    // NULL = built-in Corsa transcript
+    uint32_t latency_us;            // Adapter response time
+    uint32_t jitter_us;             // +/- deviation of the response time
+    uint32_t byte_us;               // Time per reply byte
+    uint32_t seconds;               // Simulated polling time
+    uint32_t iterations;            // Parse benchmark iterations per reply
+    uint32_t seed;                  // Jitter seed
+    bool sport;                     // Sport mode polling (fast batch only, repeated)
+};
+
+static void printUsage() {
+    printf("Usage: program [options]\n");
+    printf("  --transcript FILE   Replay FILE instead of the built-in transcript\n");
+    printf("  --latency-ms N      Adapter response time (default 40)\n");
+    printf("  --jitter-ms N       Response time deviation, +/- (default 15)\n");
+    printf("  --byte-us N         Time per reply byte (default 100)\n");
+    printf("  --seconds N         Simulated polling time (default 60)\n");
+    printf("  --iterations N      Parse benchmark iterations (default 100000)\n");
+    printf("  --seed N            Jitter seed (default 1)\n");
+    printf("  --sport             Sport mode: fast batch back to back, bare CR repeats\n");
+}
+
+/**
+ * @return false if the command line is invalid or help was requested
+ */
+static bool parseOptions(int argc, char** argv, SimOptions& options) {
+    options.transcript_file = NULL;
+    options.latency_us = 40000;
+    options.jitter_us = 15000;
+    options.byte_us = 100;
+    options.seconds = 60;
+    options.iterations = 100000;
+    options.seed = 1;
+    options.sport = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) return false;
+        if (strcmp(arg, "--sport") == 0) {
+            options.sport = true;
+            continue;
+        }
+        if (value == NULL) {
+            printf("Missing value for %s\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--transcript") == 0) {
+            options.transcript_file = value;
+        } else if (strcmp(arg, "--latency-ms") == 0) {
+            options.latency_us = (uint32_t)(atof(value) * 1000);
+        } else if (strcmp(arg, "--jitter-ms") == 0) {
+            options.jitter_us = (uint32_t)(atof(value) * 1000);
+        } else if (strcmp(arg, "--byte-us") == 0) {
+            options.byte_us = (uint32_t)atol(value);
+        } else if (strcmp(arg, "--seconds") == 0) {
+            options.seconds = (uint32_t)atol(value);
+        } else if (strcmp(arg, "--iterations") == 0) {
+            options.iterations = (uint32_t)atol(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options.seed = (uint32_t)atol(value);
+        } else {
+            printf("Unknown option %s\n", arg);
+            return false;
+        }
+        i++;
+    }
+    return true;
+}
+
+/**
+ * Read a transcript file (caller frees the buffer)
+ */
+static char* readTranscriptFile(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* text = (char*)malloc(size + 1);
+    if (text != NULL) {
+        size_t len = fread(text, 1, size, file);
+        text[len] = '\0';
+    }
+    fclose(file);
+    return text;
+}
+
+// ============================================================================
+// TRANSPORT (same loop as elmTransact in elm_engine.cpp, on the simulated clock)
+// ============================================================================
+
+static BluetoothSerial SerialBT;
+
+// Command the adapter repeats on a bare CR (empty = unknown, send in full)
+static char last_cmd[SIM_CMD_LEN] = "";
+
+static bool simTransact(const char* cmd, ELMResponse& resp, uint32_t timeout_ms,
+                        bool repeatable) {
+    // Clear input buffer
+    while (SerialBT.available()) {
+        SerialBT.read();
+    }
+
+    // Send command - a bare CR makes the adapter repeat its last command
+    bool repeat = repeatable && cmd[0] != '\0' && strcmp(cmd, last_cmd) == 0;
+    if (!repeat) {
+        SerialBT.write((const uint8_t*)cmd, strlen(cmd));
+    }
+    SerialBT.write('\r');
+
+    // Read reply straight into the fixed buffer until '>' prompt
+    elmResetResponse(resp);
+    uint32_t start = simMillis();
+    bool complete = false;
+
+    while (!complete && simMillis() - start < timeout_ms) {
+        int available = SerialBT.available();
+        if (available <= 0) {
+            simAdvanceUs(SIM_TICK_US);  // vTaskDelay(1)
+            continue;
+        }
+        while (available-- > 0 && !complete) {
+            complete = elmFeedResponse(resp, (char)SerialBT.read());
+        }
+    }
+
+    elmParseResponse(resp, cmd);
+
+    // Only a cleanly answered command is known to be the adapter's last one
+    if (cmd[0] != '\0' && (resp.status == ELM_OK || resp.status == ELM_NO_DATA)) {
+        snprintf(last_cmd, sizeof(last_cmd), "%s", cmd);
+    } else {
+        last_cmd[0] = '\0';
+    }
+    return resp.status != ELM_TIMEOUT;
+}
+
+// ============================================================================
+// LINK REPLAY
+// ============================================================================
+
+#define SIM_MAX_COMMAND_STATS   24
+
+struct CommandStats {
+    char cmd[SIM_CMD_LEN];
+    uint32_t count;
+    uint32_t failed;        // Timeout, NO DATA or error
+    uint64_t rtt_sum_us;
+    uint64_t rtt_min_us;
+    uint64_t rtt_max_us;
+};
+
+static CommandStats command_stats[SIM_MAX_COMMAND_STATS];
+static uint8_t command_stats_count = 0;
+
+static void recordCommand(const char* cmd, ELMStatus status, uint64_t rtt_us) {
+    CommandStats* stats = NULL;
+    for (uint8_t i = 0; i < command_stats_count; i++) {
+        if (strcmp(command_stats[i].cmd, cmd) == 0) {
+            stats = &command_stats[i];
+            break;
+        }
+    }
+    if (stats == NULL) {
+        if (command_stats_count >= SIM_MAX_COMMAND_STATS) return;
+        stats = &command_stats[command_stats_count++];
+        snprintf(stats->cmd, sizeof(stats->cmd), "%s", cmd);
+        stats->count = 0;
+        stats->failed = 0;
+        stats->rtt_sum_us = 0;
+        stats->rtt_min_us = UINT64_MAX;
+        stats->rtt_max_us = 0;
+    }
+
+    stats->count++;
+    if (status != ELM_OK) stats->failed++;
+    stats->rtt_sum_us += rtt_us;
+    if (rtt_us < stats->rtt_min_us) stats->rtt_min_us = rtt_us;
+    if (rtt_us > stats->rtt_max_us) stats->rtt_max_us = rtt_us;
+}
+
+static ELMResponse rx_response;
+
+/**
+ * Send one command over the mock link and record its round trip
+ */
+static const ELMResponse& simCommand(const char* cmd, uint32_t timeout_ms,
+                                     bool repeatable = false) {
+    uint64_t start = simNowUs();
+    simTransact(cmd, rx_response, timeout_ms, repeatable);
+    recordCommand(cmd, rx_response.status, simNowUs() - start);
+    return rx_response;
+}
+
+// ============================================================================
+// DASHBOARD REDRAW MODEL (built-in "Dashboard" layout, 2 x 3 boxes)
+// ============================================================================
+
+#define SIM_BYTES_PER_PIXEL     3      // ILI9488 over SPI: 18-bit color
+
+struct SimCell {
+    uint8_t pid;            // Source of the value
+    const char* suffix;
+    uint8_t decimals;
+    uint8_t value_size;
+    uint16_t update_ms;
+    int32_t shown;
+    uint32_t last_draw_ms;
+    DirtyRect extent;
+};
+
+static SimCell sim_cells[] = {
+    {PID_RPM,             "",  0, 3, 0,    METRIC_NONE, 0, {0, 0, 0, 0}},
+    {PID_SPEED,           "",  0, 3, 0,    METRIC_NONE, 0, {0, 0, 0, 0}},
+    {PID_COOLANT_TEMP,    "",  1, 3, 1000, METRIC_NONE, 0, {0, 0, 0, 0}},
+    {PID_THROTTLE,        "%", 0, 3, 0,    METRIC_NONE, 0, {0, 0, 0, 0}},
+    {PID_BATTERY_VOLTAGE, "V", 1, 3, 1000, METRIC_NONE, 0, {0, 0, 0, 0}},
+    {PID_INTAKE_TEMP,     "",  1, 3, 1000, METRIC_NONE, 0, {0, 0, 0, 0}},
+};
+
+#define SIM_CELL_COUNT  (sizeof(sim_cells) / sizeof(sim_cells[0]))
+
+// Box width of a 2-column grid (computeDashboardCellRect)
+static const int16_t SIM_BOX_W = (SCREEN_WIDTH - 3 * DASHBOARD_CELL_MARGIN) / 2;
+
+struct RedrawStats {
+    uint32_t frames;
+    uint64_t pixels;
+    uint64_t full_pixels;       // Same frames, value cells rewritten whole
+    uint32_t max_pixels;
+    uint32_t cells_drawn;
+};
+
+static float live_values[256];  // Latest value per Mode 01 PID
+
+/**
+ * One display frame: redraw the cells whose value changed at display precision
+ */
+static void simDashboardFrame(RedrawStats& stats) {
+    uint32_t now = simMillis();
+    uint32_t frame_pixels = 0;
+
+    for (uint8_t i = 0; i < SIM_CELL_COUNT; i++) {
+        SimCell& cell = sim_cells[i];
+        int32_t quantized = metricQuantize(live_values[cell.pid], cell.decimals);
+        if (metricChange(cell.shown, quantized, cell.update_ms, cell.last_draw_ms, now) !=
+            METRIC_REDRAW) {
+            continue;
+        }
+
+        int16_t cell_w = metricValueCellWidth(SIM_BOX_W, cell.value_size);
+        int16_t cell_h = cell.value_size * 8 + 4;
+
+        char text[16];
+        metricFormat(text, sizeof(text), quantized, cell.decimals, cell.suffix);
+        int16_t text_w = digitTextWidth(text, cell.value_size);
+        int16_t text_x;
+        DirtyRect dirty = dirtyRectTextCell(cell_w, cell_h, text_w, cell.value_size * 8,
+                                            cell.extent, text_x);
+
+        frame_pixels += (uint32_t)dirty.w * dirty.h;
+        stats.full_pixels += (uint32_t)cell_w * cell_h;
+        stats.cells_drawn++;
+        cell.shown = quantized;
+        cell.last_draw_ms = now;
+    }
+
+    stats.frames++;
+    stats.pixels += frame_pixels;
+    if (frame_pixels > stats.max_pixels) stats.max_pixels = frame_pixels;
+}
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+static const uint8_t FAST_PIDS[] = {PID_RPM, PID_SPEED, PID_THROTTLE};
+static const uint8_t SLOW_PIDS[] = {PID_COOLANT_TEMP, PID_INTAKE_TEMP, PID_BATTERY_VOLTAGE};
+
+static const char* const SETUP_COMMANDS[] = {
+    "ATZ", "ATI", "ATPPS", "ATE0", "ATL0", "ATS0", "ATH0", "ATAT1", "ATST32",
+    "ATSP0", "0100", "ATDPN", "0902", "03", "07", "0A",
+};
+
+/**
+ * Decode a batch reply into live_values
+ * @return Number of PIDs decoded
+ */
+static int decodeBatch(const ELMResponse& resp, const uint8_t* pids, uint8_t count) {
+    PIDReading readings[8];
+    int decoded = decodeMultiPIDResponse(resp, pids, count, readings);
+    for (int i = 0; i < count && decoded > 0; i++) {
+        if (readings[i].valid) {
+            live_values[readings[i].pid] = decodePIDValue(readings[i].pid, readings[i].data);
+        }
+    }
+    return decoded > 0 ? decoded : 0;
+}
+
+/**
+ * Replay setup and polling on the simulated clock
+ */
+static void runLinkReplay(const SimOptions& options) {
+    printf("\n== Link replay%s (latency %.1f ms +/- %.1f ms, %u us/byte, %u s) ==\n",
+           options.sport ? ", sport mode" : "",
+           options.latency_us / 1000.0, options.jitter_us / 1000.0,
+           (unsigned)options.byte_us, (unsigned)options.seconds);
+
+    for (size_t i = 0; i < sizeof(SETUP_COMMANDS) / sizeof(SETUP_COMMANDS[0]); i++) {
+        simCommand(SETUP_COMMANDS[i], ELM327_TIMEOUT_MS);
+    }
+
+    // Poll the two batches on their PID intervals, back to back when both are due
+    RedrawStats redraw = {0, 0, 0, 0, 0};
+    uint64_t samples = 0;
+    uint32_t queries = 0;
+    uint64_t allocations_before = allocation_count;
+    uint32_t start_ms = simMillis();
+    uint32_t end_ms = start_ms + options.seconds * 1000;
+    uint32_t next_fast = start_ms;
+    uint32_t next_slow = start_ms;
+
+    while (simMillis() < end_ms) {
+        uint32_t now = simMillis();
+        if (options.sport) {
+            // Always due, same request every time (obd2_task.cpp submitDuePoll)
+            samples += decodeBatch(simCommand("010C0D11", ELM327_TIMEOUT_MS, SPORT_MODE_REPEAT),
+                                   FAST_PIDS, 3);
+        } else if ((int32_t)(now - next_fast) >= 0) {
+            next_fast = now + PID_INTERVAL_RPM_MS;
+            samples += decodeBatch(simCommand("010C0D11", ELM327_TIMEOUT_MS), FAST_PIDS, 3);
+        } else if ((int32_t)(now - next_slow) >= 0) {
+            next_slow = now + PID_INTERVAL_BATTERY_MS;
+            samples += decodeBatch(simCommand("01050F42", ELM327_TIMEOUT_MS), SLOW_PIDS, 3);
+        } else {
+            // Scheduler idles until the next PID is due
+            uint32_t next = (int32_t)(next_fast - next_slow) < 0 ? next_fast : next_slow;
+            simAdvanceUs((uint64_t)(next - now) * 1000);
+            continue;
+        }
+        queries++;
+        simDashboardFrame(redraw);  // Display task wakes on every completed poll
+    }
+    uint64_t allocations = allocation_count - allocations_before;
+    double elapsed_s = (simMillis() - start_ms) / 1000.0;
+
+    printf("%-10s %7s %6s %9s %9s %9s\n", "command", "count", "fail", "rtt avg", "min", "max");
+    for (uint8_t i = 0; i < command_stats_count; i++) {
+        const CommandStats& stats = command_stats[i];
+        printf("%-10s %7u %6u %7.1fms %7.1fms %7.1fms\n", stats.cmd, (unsigned)stats.count,
+               (unsigned)stats.failed, stats.rtt_sum_us / 1000.0 / stats.count,
+               stats.rtt_min_us / 1000.0, stats.rtt_max_us / 1000.0);
+    }
+    if (SerialBT.unknownCommands() > 0) {
+        printf("unknown commands (answered '?'): %u\n", (unsigned)SerialBT.unknownCommands());
+    }
+
+    printf("queries/s         %8.1f\n", queries / elapsed_s);
+    printf("PID samples/s     %8.1f\n", samples / elapsed_s);
+    printf("allocations/query %8.3f\n", queries > 0 ? (double)allocations / queries : 0.0);
+
+    printf("\n== Redraw bytes per frame (Dashboard layout, %u cells) ==\n",
+           (unsigned)SIM_CELL_COUNT);
+    if (redraw.frames == 0) return;
+    printf("frames            %8u\n", (unsigned)redraw.frames);
+    printf("cells drawn/frame %8.2f\n", (double)redraw.cells_drawn / redraw.frames);
+    printf("bytes/frame avg   %8.0f (full value cells: %.0f)\n",
+           (double)redraw.pixels * SIM_BYTES_PER_PIXEL / redraw.frames,
+           (double)redraw.full_pixels * SIM_BYTES_PER_PIXEL / redraw.frames);
+    printf("bytes/frame max   %8u (%u px, budget %u px per %u ms)\n",
+           (unsigned)(redraw.max_pixels * SIM_BYTES_PER_PIXEL), (unsigned)redraw.max_pixels,
+           (unsigned)DISPLAY_PIXEL_BUDGET, (unsigned)DISPLAY_BUDGET_WINDOW_MS);
+}
+
+/**
+ * Capture the raw reply to a command (zero-latency link)
+ * @return Reply length including the '>' prompt
+ */
+static size_t captureReply(const char* cmd, char* buffer, size_t size) {
+    SerialBT.setLatency(0, 0);
+    SerialBT.setByteTime(0);
+    SerialBT.write((const uint8_t*)cmd, strlen(cmd));
+    SerialBT.write('\r');
+
+    size_t len = 0;
+    int c;
+    while (len < size - 1 && (c = SerialBT.read()) >= 0) {
+        buffer[len++] = (char)c;
+        if (c == '>') break;
+    }
+    buffer[len] = '\0';
+    return len;
+}
+
+enum ParseKind : uint8_t {
+    PARSE_MULTI_PID,
+    PARSE_DTC,
+    PARSE_VIN
+};
+
+struct ParseCase {
+    const char* cmd;
+    ParseKind kind;
+};
+
+static const ParseCase PARSE_CASES[] = {
+    {"010C0D11", PARSE_MULTI_PID},
+    {"01050F42", PARSE_MULTI_PID},
+    {"010C",     PARSE_MULTI_PID},
+    {"03",       PARSE_DTC},
+    {"0902",     PARSE_VIN},
+};
+
+/**
+ * Feed, parse and decode one captured reply
+ * @return Decoded item count (keeps the work observable)
+ */
+static int parseOnce(const ParseCase& test, const char* reply, size_t len, ELMResponse& resp) {
+    elmResetResponse(resp);
+    for (size_t i = 0; i < len; i++) {
+        if (elmFeedResponse(resp, reply[i])) break;
+    }
+    elmParseResponse(resp, test.cmd);
+
+    switch (test.kind) {
+        case PARSE_MULTI_PID: {
+            uint8_t pids[6];
+            uint8_t count = 0;
+            for (size_t i = 2; test.cmd[i] != '\0' && test.cmd[i + 1] != '\0' && count < 6; i += 2) {
+                char hex[3] = {test.cmd[i], test.cmd[i + 1], '\0'};
+                pids[count++] = (uint8_t)strtol(hex, NULL, 16);
+            }
+            PIDReading readings[6];
+            return decodeMultiPIDResponse(resp, pids, count, readings);
+        }
+        case PARSE_DTC: {
+            uint16_t codes[MAX_DTC_CODES];
+            int found = decodeDTCResponse(resp, 0x43, codes, MAX_DTC_CODES);
+            int described = 0;
+            for (int i = 0; i < found; i++) {
+                if (findDTCInfo(codes[i]) != NULL) described++;
+            }
+            return found + described;
+        }
+        case PARSE_VIN: {
+            OBDResponseView view;
+            return findPIDResponse(resp, 0x49, 0x02, view) ? view.payload_len : -1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Host cost of feed + parse + decode per response
+ */
+static void runParseBenchmark(const SimOptions& options) {
+    printf("\n== Parse cost (host, %u iterations) ==\n", (unsigned)options.iterations);
+    printf("%-10s %6s %10s %12s\n", "reply", "bytes", "ns/resp", "allocs/resp");
+
+    static ELMResponse resp;
+    static char reply[ELM327_RX_BUFFER_SIZE];
+    SerialBT.rewind();  // First recorded reply of each command
+
+    for (size_t c = 0; c < sizeof(PARSE_CASES) / sizeof(PARSE_CASES[0]); c++) {
+        const ParseCase& test = PARSE_CASES[c];
+        size_t len = captureReply(test.cmd, reply, sizeof(reply));
+
+        volatile int sink = 0;
+        uint64_t allocations_before = allocation_count;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < options.iterations; i++) {
+            sink = sink + parseOnce(test, reply, len, resp);
+        }
+        auto end = std::chrono::steady_clock::now();
+        uint64_t allocations = allocation_count - allocations_before;
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        printf("%-10s %6u %10.1f %12.3f%s\n", test.cmd, (unsigned)len,
+               options.iterations > 0 ? ns / options.iterations : 0.0,
+               options.iterations > 0 ? (double)allocations / options.iterations : 0.0,
+               resp.status == ELM_OK ? "" : "  (no data)");
+    }
+}
+
+/**
+ * Atlas size and host rasterization time per text size (digit_atlas.h)
+ */
+static void runAtlasBenchmark() {
+    printf("\n== Digit atlas (%u glyphs, %dx%d supersampling) ==\n",
+           (unsigned)DIGIT_GLYPH_COUNT, DIGIT_SUPERSAMPLE, DIGIT_SUPERSAMPLE);
+    printf("%-5s %8s %10s %10s\n", "size", "bytes", "host us", "edge px");
+
+    static uint8_t coverage[8 * DASHBOARD_MAX_VALUE_SIZE * DIGIT_CELL_ROWS * DASHBOARD_MAX_VALUE_SIZE];
+    for (uint8_t size = 2; size <= DASHBOARD_MAX_VALUE_SIZE; size++) {
+        uint32_t bytes = 0;
+        uint32_t edge = 0;     // Partially covered (anti-aliased) pixels
+        auto start = std::chrono::steady_clock::now();
+        for (uint8_t i = 0; i < DIGIT_GLYPH_COUNT; i++) {
+            uint32_t glyph_bytes = digitGlyphBytes(digit_glyphs[i], size);
+            rasterizeDigitGlyph(digit_glyphs[i], size, coverage);
+            for (uint32_t p = 0; p < glyph_bytes; p++) {
+                if (coverage[p] > 0 && coverage[p] < DIGIT_COVERAGE_MAX) edge++;
+            }
+            bytes += glyph_bytes;
+        }
+        auto end = std::chrono::steady_clock::now();
+        printf("%-5u %8u %10.1f %10u\n", (unsigned)size, (unsigned)bytes,
+               std::chrono::duration<double, std::micro>(end - start).count(), (unsigned)edge);
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char** argv) {
+    SimOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    char* file_text = NULL;
+    const char* transcript = TRANSCRIPT_CORSA;
+    if (options.transcript_file != NULL) {
+        file_text = readTranscriptFile(options.transcript_file);
+        if (file_text == NULL) {
+            printf("ERROR: Cannot read %s\n", options.transcript_file);
+            return 1;
+        }
+        transcript = file_text;
+    }
+
+    int exchanges = SerialBT.loadTranscript(transcript);
+    if (exchanges <= 0) {
+        printf("ERROR: Transcript is empty or too large\n");
+        free(file_text);
+        return 1;
+    }
+    printf("Transcript: %s (%d exchanges)\n",
+           options.transcript_file != NULL ? options.transcript_file : "built-in Corsa D", exchanges);
+
+    SerialBT.begin("OBDeck-sim", true);
+    SerialBT.connect(BT_DEVICE_NAME);
+    SerialBT.setSeed(options.seed);
+    SerialBT.setLatency(options.latency_us, options.jitter_us);
+    SerialBT.setByteTime(options.byte_us);
+
+    runLinkReplay(options);
+    runParseBenchmark(options);
+    runAtlasBenchmark();
+
+    free(file_text);
+    return 0;
+}
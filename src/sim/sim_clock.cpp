@@ -0,0 +1,15 @@
+/**
+ * Simulated Clock - Implementation
+ */
+
+#include "sim_clock.h"
+
+static uint64_t now_us = 0;
+
+uint64_t simNowUs() {
+    return now_us;
+}
+
+void simAdvanceUs(uint64_t us) {
+    now_us += us;
+}
@@ -0,0 +1,35 @@
+/**
+ * Simulated Clock (host simulation build)
+ *
+ * Microsecond time that only moves when the simulation advances it:
+ * the mock link schedules reply bytes on it and idle waits skip ahead,
+ * so a minute of polling replays in milliseconds of host time
+ */
+
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+// One FreeRTOS tick (vTaskDelay(1) in the transport read loop)
+#define SIM_TICK_US     1000
+
+/**
+ * Current simulated time (us since start)
+ */
+uint64_t simNowUs();
+
+/**
+ * Current simulated time in ms (millis() equivalent)
+ */
+inline uint32_t simMillis() {
+    return (uint32_t)(simNowUs() / 1000);
+}
+
+/**
+ * Move simulated time forward
+ * @param us Microseconds to advance
+ */
+void simAdvanceUs(uint64_t us);
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,133 @@
+/**
+ * Built-in Transcript - 2010 Opel Corsa D on ISO 15765-4 CAN (11 bit, 500 kbaud)
+ *
+ * Adapter setup as sent by elm327.cpp (echo, linefeeds, spaces and headers
+ * off), followed by the polling loop: the fast batch 010C0D11 and the slow
+ * batch 01050F42 are recorded several times with changing values; both are
+ * ISO-TP multi-frame replies ("008" byte count, "0:"/"1:" frame indices,
+ * padding after the declared length), one of them followed by a second ECU's
+ * single-frame reply. DTC modes, VIN and one NO DATA round off the mix.
+ *
+ * Format (also for --transcript files):
+ *   > CMD       command as sent (without CR)
+ *   reply       one line per reply line, ended by the next "> " line
+ *   # ...       comment
+ */
+
+#ifndef SIM_TRANSCRIPT_CORSA_H
+#define SIM_TRANSCRIPT_CORSA_H
+
+static const char TRANSCRIPT_CORSA[] = R"TRANSCRIPT(
+# ---- Adapter setup ----
+> ATZ
+
+ELM327 v1.5
+> ATI
+ELM327 v1.5
+> ATPPS
+00:FF F  01:00 F  02:FF F  03:32 F
+> ATE0
+OK
+> ATL0
+OK
+> ATS0
+OK
+> ATH0
+OK
+> ATAT1
+OK
+> ATST32
+OK
+> ATSP0
+OK
+> 0100
+SEARCHING...
+4100BE3EB813
+> ATDPN
+A6
+
+# ---- Vehicle info ----
+> 0902
+014
+0:49020157304C
+1:3053444C303839
+2:36313233343536
+> 03
+430201330420
+> 07
+4700
+> 0A
+4A00
+
+# ---- Fast batch: RPM, speed, throttle ----
+> 010C0D11
+008
+0:410C0C800D00
+1:11080000000000
+> 010C0D11
+008
+0:410C0FA00D0A
+1:11100000000000
+> 010C0D11
+008
+0:410C13880D14
+1:11180000000000
+> 010C0D11
+008
+0:410C17700D1E
+1:11200000000000
+> 010C0D11
+008
+0:410C1F400D28
+1:11400000000000
+> 010C0D11
+008
+0:410C27100D32
+1:11600000000000
+> 010C0D11
+008
+0:410C2EE00D46
+1:11500000000000
+> 010C0D11
+008
+0:410C36B00D50
+1:11300000000000
+# Gearbox ECU (7E9) answers speed as a single frame after the engine's ISO-TP reply
+> 010C0D11
+008
+0:410C32C80D50
+1:11280000000000
+410D50
+
+# ---- Slow batch: coolant, intake, battery ----
+> 01050F42
+008
+0:41057B0F3C42
+1:35840000000000
+> 01050F42
+008
+0:41057C0F3C42
+1:35980000000000
+> 01050F42
+NO DATA
+> 01050F42
+008
+0:41057D0F3D42
+1:35840000000000
+
+# ---- Single PIDs (fallback without batching) ----
+> 010C
+410C0FA0
+> 010D
+410D32
+> 0111
+411140
+> 0105
+41057B
+> 010F
+410F3C
+> 0142
+41423584
+)TRANSCRIPT";
+
+#endif // SIM_TRANSCRIPT_CORSA_H
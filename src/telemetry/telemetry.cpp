@@ -0,0 +1,212 @@
+/**
+ * Telemetry Module - Implementation
+ */
+
+#include "telemetry.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <ArduinoJson.h>
+#include <esp_coexist.h>
+#include <atomic>
+#include <math.h>
+#include "../obd2/obd_data.h"
+#include "../obd2/pid_history.h"
+
+// ============================================================================
+// STATE (sender task only, counters readable from any task)
+// ============================================================================
+
+static const uint8_t telemetry_pids[] = TELEMETRY_PIDS;
+
+#define TELEMETRY_PID_COUNT  (sizeof(telemetry_pids) / sizeof(telemetry_pids[0]))
+
+static WiFiUDP udp;
+static uint8_t frame_buffer[TELEMETRY_FRAME_BYTES];
+static uint32_t next_seq[TELEMETRY_PID_COUNT];   // Next sample to send per PID
+
+static std::atomic<uint32_t> frames_sent(0);
+static std::atomic<uint32_t> samples_sent(0);
+static std::atomic<uint32_t> samples_lost(0);
+
+// ============================================================================
+// WI-FI
+// ============================================================================
+
+/**
+ * Start the access point or join the network (returns without waiting)
+ */
+static void startWiFi() {
+    // Bluetooth keeps priority on the shared radio: the ELM327 link must not lose throughput
+    esp_coex_preference_set(ESP_COEX_PREFER_BT);
+
+#if TELEMETRY_WIFI_AP
+    WiFi.mode(WIFI_AP);
+    if (!WiFi.softAP(TELEMETRY_WIFI_SSID, TELEMETRY_WIFI_PASSWORD, TELEMETRY_WIFI_CHANNEL, 0, 2)) {
+        Serial.println("[Telemetry] Access point start failed");
+        return;
+    }
+    Serial.printf("[Telemetry] AP \"%s\" at %s, UDP port %d\n", TELEMETRY_WIFI_SSID,
+                  WiFi.softAPIP().toString().c_str(), TELEMETRY_UDP_PORT);
+#else
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+    WiFi.begin(TELEMETRY_WIFI_SSID, TELEMETRY_WIFI_PASSWORD);
+    Serial.printf("[Telemetry] Joining \"%s\", UDP port %d\n", TELEMETRY_WIFI_SSID, TELEMETRY_UDP_PORT);
+#endif
+    // Modem sleep stays on: required while Classic BT shares the radio
+}
+
+/**
+ * @return true if frames can be sent
+ */
+static bool wifiReady() {
+#if TELEMETRY_WIFI_AP
+    return true;
+#else
+    return WiFi.status() == WL_CONNECTED;
+#endif
+}
+
+static IPAddress broadcastAddress() {
+#if TELEMETRY_WIFI_AP
+    return WiFi.softAPBroadcastIP();
+#else
+    return WiFi.broadcastIP();
+#endif
+}
+
+// ============================================================================
+// FRAMES
+// ============================================================================
+
+/**
+ * Add a float, nil for NAN (derived value not known yet)
+ */
+static void addValue(JsonArray array, float value) {
+    if (isnan(value)) {
+        array.add(nullptr);
+    } else {
+        array.add(value);
+    }
+}
+
+/**
+ * Append new samples of all PIDs, oldest first per PID
+ * Samples beyond TELEMETRY_MAX_SAMPLES stay queued for the next frame
+ * @return Number of samples added
+ */
+static uint32_t addSamples(JsonArray samples, uint32_t now) {
+    uint32_t added = 0;
+
+    for (uint8_t i = 0; i < TELEMETRY_PID_COUNT && added < TELEMETRY_MAX_SAMPLES; i++) {
+        uint8_t pid = telemetry_pids[i];
+        uint32_t count = pidHistoryCount(pid);
+
+        // Fell behind by more than a ring - skip to the oldest sample still stored
+        if (count - next_seq[i] > PID_HISTORY_CAPACITY) {
+            uint32_t oldest = count - PID_HISTORY_CAPACITY;
+            samples_lost.fetch_add(oldest - next_seq[i], std::memory_order_relaxed);
+            next_seq[i] = oldest;
+        }
+
+        while (next_seq[i] != count && added < TELEMETRY_MAX_SAMPLES) {
+            PIDSample sample;
+            if (pidHistoryRead(pid, next_seq[i], sample)) {
+                JsonArray entry = samples.add<JsonArray>();
+                entry.add(pid);
+                entry.add(now - sample.time_ms);
+                entry.add(sample.value);
+                added++;
+            } else {
+                samples_lost.fetch_add(1, std::memory_order_relaxed);  // Overwritten while reading
+            }
+            next_seq[i]++;
+        }
+    }
+    return added;
+}
+
+/**
+ * Encode and send one frame
+ */
+static void sendFrame(JsonDocument& doc, uint32_t frame_number, uint32_t now) {
+    LiveData live;
+    live_data.read(live);
+
+    doc.clear();
+    doc["n"] = frame_number;
+    doc["t"] = now;
+    doc["c"] = live.connected;
+    doc["l"] = samples_lost.load(std::memory_order_relaxed);
+
+    uint32_t added = addSamples(doc["s"].to<JsonArray>(), now);
+
+    JsonArray derived = doc["d"].to<JsonArray>();
+    addValue(derived, live.fuel_rate);
+    addValue(derived, live.consumption);
+    addValue(derived, live.trip_consumption);
+    addValue(derived, live.engine_load);
+    addValue(derived, live.boost);
+
+    if (doc.overflowed() || measureMsgPack(doc) > sizeof(frame_buffer)) {
+        Serial.println("[Telemetry] Frame too large - dropped (lower TELEMETRY_MAX_SAMPLES)");
+        samples_lost.fetch_add(added, std::memory_order_relaxed);
+        return;
+    }
+    size_t length = serializeMsgPack(doc, frame_buffer, sizeof(frame_buffer));
+
+    udp.beginPacket(broadcastAddress(), TELEMETRY_UDP_PORT);
+    udp.write(frame_buffer, length);
+    if (udp.endPacket()) {
+        frames_sent.fetch_add(1, std::memory_order_relaxed);
+        samples_sent.fetch_add(added, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Sender task - one frame per batch interval, only while the network is up
+ */
+static void telemetryTask(void* parameter) {
+    startWiFi();
+
+    // Stream starts at the present, not with the history since boot
+    for (uint8_t i = 0; i < TELEMETRY_PID_COUNT; i++) {
+        next_seq[i] = pidHistoryCount(telemetry_pids[i]);
+    }
+
+    JsonDocument doc;
+    uint32_t frame_number = 0;
+    TickType_t last_wake = xTaskGetTickCount();
+
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(TELEMETRY_BATCH_MS));
+        if (!wifiReady()) continue;
+
+        sendFrame(doc, frame_number++, millis());
+    }
+}
+
+// ============================================================================
+// INITIALIZATION
+// ============================================================================
+
+void startTelemetry() {
+    if (!TELEMETRY_ENABLED) return;
+
+    xTaskCreatePinnedToCore(
+        telemetryTask,               // Task function
+        "TelemetryTask",             // Task name
+        TELEMETRY_TASK_STACK_SIZE,   // Stack size
+        NULL,                        // Parameters
+        TELEMETRY_TASK_PRIORITY,     // Priority
+        NULL,                        // Task handle
+        TELEMETRY_TASK_CORE          // Core (1)
+    );
+    Serial.println("✓ Telemetry task started");
+}
+
+void getTelemetryStats(uint32_t& frames, uint32_t& samples, uint32_t& lost) {
+    frames = frames_sent.load(std::memory_order_relaxed);
+    samples = samples_sent.load(std::memory_order_relaxed);
+    lost = samples_lost.load(std::memory_order_relaxed);
+}
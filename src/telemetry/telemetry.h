@@ -0,0 +1,44 @@
+/**
+ * Telemetry Module
+ *
+ * Optional live stream over Wi-Fi for a laptop or phone in the pit:
+ * - Own access point or station mode (TELEMETRY_WIFI_AP), UDP broadcast
+ *   on TELEMETRY_UDP_PORT - nothing to pair, any listener on the subnet
+ * - One MessagePack frame per TELEMETRY_BATCH_MS with every new sample,
+ *   read from the PID history rings (pid_history.h, readers never block
+ *   the OBD2 task) plus the derived values of the live block
+ * - Low-priority sender task on Core 1; Wi-Fi/BT coexistence prefers BT,
+ *   so the SPP link to the ELM327 keeps its throughput
+ *
+ * Frame (MessagePack map):
+ *   n: frame number         t: send time (ms since boot)
+ *   c: connected            l: samples lost since boot (overwritten unsent)
+ *   s: [[pid, age_ms, value], ...]   age = t - sample time
+ *   d: [fuel_rate, consumption, trip_consumption, engine_load, boost] (nil = unknown)
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// FUNCTION DECLARATIONS
+// ============================================================================
+
+/**
+ * Bring up Wi-Fi and start the sender task (no-op if TELEMETRY_ENABLED is false)
+ * Call after initOBD2() (history rings allocated)
+ */
+void startTelemetry();
+
+/**
+ * Sender counters (any task)
+ * @param frames Frames sent
+ * @param samples Samples sent
+ * @param lost Samples overwritten in the rings before they were sent
+ */
+void getTelemetryStats(uint32_t& frames, uint32_t& samples, uint32_t& lost);
+
+#endif // TELEMETRY_H